@@ -23,6 +23,7 @@
 #include <vector>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/prevout_table.hpp>
 #include <bitcoin/system/chain/transaction.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -104,6 +105,15 @@ public:
     code check() const NOEXCEPT;
     code accept(const context& state, size_t subsidy_interval,
         uint64_t initial_subsidy) const NOEXCEPT;
+
+    /// As accept, but with prevout metadata read from the table (all inputs
+    /// in block order, including coinbase), in one fused sweep over the
+    /// inputs of each tx. Transactions are accepted concurrently if parallel.
+    /// Returns the same (first) error as accept. Sigop counting still
+    /// requires that input.prevout scripts are populated.
+    code accept(const context& state, size_t subsidy_interval,
+        uint64_t initial_subsidy, const prevout_table& prevouts,
+        bool parallel=false) const NOEXCEPT;
     code connect(const context& state) const NOEXCEPT;
 
 protected:
@@ -142,6 +152,13 @@ protected:
     // prevout confirmation state required
     bool is_unspent_coinbase_collision(size_t height) const NOEXCEPT;
 
+    // prevout table (block input order) required
+    bool is_overspent(size_t height, uint64_t subsidy_interval,
+        uint64_t initial_block_subsidy_satoshi, bool bip42,
+        const prevout_table& prevouts) const NOEXCEPT;
+    bool is_unspent_coinbase_collision(size_t height,
+        const prevout_table& prevouts) const NOEXCEPT;
+
     // TX: error::transaction_non_final (context)
     // TX: error::missing_previous_output (prevouts)
     // TX: error::spend_exceeds_value (prevouts)
@@ -151,6 +168,17 @@ protected:
     // TX: error::confirmed_double_spend (prevout confirmation state)
 
 private:
+    // Salted open_set hashers (sha256 outputs are uniformly distributed).
+    struct txid_hash
+    {
+        size_t operator()(const hash_digest& hash) const NOEXCEPT;
+    };
+
+    struct point_hash
+    {
+        size_t operator()(const point& point) const NOEXCEPT;
+    };
+
     static block from_data(reader& source, bool witness) NOEXCEPT;
 
     // context free
@@ -164,6 +192,8 @@ private:
     // delegated
     code check_transactions() const NOEXCEPT;
     code accept_transactions(const context& state) const NOEXCEPT;
+    code accept_transactions(const context& state,
+        const prevout_table& prevouts, bool parallel) const NOEXCEPT;
     code connect_transactions(const context& state) const NOEXCEPT;
 
     // Block should be stored as shared (adds 16 bytes).
@@ -108,6 +108,15 @@ public:
     hash_digest hash() const NOEXCEPT;
     uint256_t difficulty() const NOEXCEPT;
 
+    // Mining.
+    // ------------------------------------------------------------------------
+
+    /// Search count nonces (wrapping) from first for one that satisfies the
+    /// header bits (sha256 proof of work). The header prefix is hashed once.
+    /// False if not found or bits is invalid (nonce unchanged).
+    bool find_nonce(uint32_t& nonce, uint32_t first=0,
+        uint32_t count=max_uint32) const NOEXCEPT;
+
     // Validation.
     // ------------------------------------------------------------------------
 
@@ -109,6 +109,11 @@ public:
     // Methods.
     // ------------------------------------------------------------------------
 
+    /// BIP68 relative lock of a sequence given the prevout height and mtp.
+    static bool is_locked(uint32_t sequence, size_t height,
+        uint32_t median_time_past, size_t prevout_height,
+        uint32_t prevout_median_time_past) NOEXCEPT;
+
     bool is_final() const NOEXCEPT;
     bool is_locked(size_t height, uint32_t median_time_past) const NOEXCEPT;
     bool reserved_hash(hash_digest& out) const NOEXCEPT;
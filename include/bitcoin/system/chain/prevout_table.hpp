@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_PREVOUT_TABLE_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_PREVOUT_TABLE_HPP
+
+#include <vector>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/prevout.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+/// Compact fixed-layout prevout metadata (no script), e.g. as a utxo record.
+/// Defaults match those of a default (not found) chain::prevout.
+struct prevout_record
+{
+    static constexpr uint8_t found = bit_right<uint8_t>(0);
+    static constexpr uint8_t spent = bit_right<uint8_t>(1);
+    static constexpr uint8_t coinbase = bit_right<uint8_t>(2);
+
+    /// The value of the output (max_uint64 if not found).
+    uint64_t value{ max_uint64 };
+
+    /// The confirmed chain height of the prevout (zero if not found).
+    uint32_t height{ 0 };
+
+    /// The median time past at height (max_uint32 if not found/confirmed).
+    uint32_t median_time_past{ max_uint32 };
+
+    /// Opaque offset of the output script within the caller's store.
+    uint32_t script_offset{ 0 };
+
+    /// Bitwise combination of found, spent and coinbase.
+    uint8_t flags{ spent };
+};
+
+/// Columnar (struct of arrays) prevout metadata for a set of transactions.
+/// Records are ordered as the inputs of the transactions, including coinbase,
+/// so that the records of each tx are the contiguous range beginning at the
+/// sum of the input counts of the preceding txs. The range checks below are
+/// equivalent to the like-named transaction checks over input.prevout.
+class BC_API prevout_table
+{
+public:
+    /// Defaults.
+    prevout_table(prevout_table&&) = default;
+    prevout_table(const prevout_table&) = default;
+    prevout_table& operator=(prevout_table&&) = default;
+    prevout_table& operator=(const prevout_table&) = default;
+    ~prevout_table() = default;
+
+    /// Empty table.
+    prevout_table() NOEXCEPT;
+
+    /// Empty table with capacity for count records.
+    explicit prevout_table(size_t count) NOEXCEPT;
+
+    /// Table gathered from the input.prevout of each input of txs.
+    explicit prevout_table(const transaction_ptrs& txs) NOEXCEPT;
+
+    /// Properties.
+    bool empty() const NOEXCEPT;
+    size_t size() const NOEXCEPT;
+    prevout_record at(size_t index) const NOEXCEPT;
+
+    /// Columns.
+    const std::vector<uint64_t>& values() const NOEXCEPT;
+    const std::vector<uint32_t>& heights() const NOEXCEPT;
+    const std::vector<uint32_t>& median_times_past() const NOEXCEPT;
+    const std::vector<uint32_t>& script_offsets() const NOEXCEPT;
+    const std::vector<uint8_t>& flags() const NOEXCEPT;
+
+    /// Population.
+    void reserve(size_t count) NOEXCEPT;
+    void push_back(const prevout_record& record) NOEXCEPT;
+    void push_back(const chain::prevout& prevout) NOEXCEPT;
+    void clear() NOEXCEPT;
+
+    /// Range checks, over records [first, first + count).
+    bool is_missing(size_t first, size_t count) const NOEXCEPT;
+    uint64_t value(size_t first, size_t count) const NOEXCEPT;
+    bool is_immature(size_t first, size_t count,
+        size_t height) const NOEXCEPT;
+    bool is_locked(size_t first, const input_cptrs& inputs, size_t height,
+        uint32_t median_time_past) const NOEXCEPT;
+    bool is_unconfirmed_spend(size_t first, size_t count,
+        size_t height) const NOEXCEPT;
+    bool is_confirmed_double_spend(size_t first, size_t count,
+        size_t height) const NOEXCEPT;
+
+    /// All of the range checks (and overspend against claim) in one sweep
+    /// over the records of inputs, starting at first. Returns the first error
+    /// in the order of transaction::accept, relative_locks implies bip68.
+    code accept(size_t first, const input_cptrs& inputs, uint64_t claim,
+        size_t height, uint32_t median_time_past,
+        bool relative_locks) const NOEXCEPT;
+
+private:
+    std::vector<uint64_t> values_;
+    std::vector<uint32_t> heights_;
+    std::vector<uint32_t> median_times_past_;
+    std::vector<uint32_t> script_offsets_;
+    std::vector<uint8_t> flags_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -38,12 +38,27 @@ namespace libbitcoin {
 namespace system {
 namespace chain {
 
+class prevout_table;
+
 class BC_API transaction
 {
 public:
     typedef std::shared_ptr<const transaction> cptr;
     typedef input_cptrs::const_iterator input_iterator;
 
+    /// Parameters for the endorsement of one input (sub script is shared).
+    struct signer
+    {
+        ec_secret secret;
+        script::cptr sub;
+        uint32_t index;
+        uint64_t value;
+        uint8_t flags;
+        script_version version;
+    };
+
+    typedef std::vector<signer> signers;
+
     // Constructors.
     // ------------------------------------------------------------------------
 
@@ -129,6 +144,14 @@ public:
         const script& sub, uint32_t index, uint64_t value, uint8_t flags,
         script_version version, bool bip143) const NOEXCEPT;
 
+    /// Endorse any number of inputs, with out resized to signers. Signature
+    /// hash components are cached once for all inputs, inputs are signed in
+    /// parallel (where available) and the capacity of existing endorsements
+    /// is reused. Nonces are RFC6979 unless deterministic is false, in which
+    /// case each is also hedged with pseudo random entropy.
+    bool create_endorsements(endorsements& out, const signers& signers,
+        bool bip143, bool deterministic=true) const NOEXCEPT;
+
     // Guards (for tx pool without compact blocks).
     // ------------------------------------------------------------------------
 
@@ -140,6 +163,8 @@ public:
 
     code check() const NOEXCEPT;
     code accept(const context& state) const NOEXCEPT;
+    code accept(const context& state, const prevout_table& prevouts,
+        size_t first) const NOEXCEPT;
     code connect(const context& state) const NOEXCEPT;
 
 protected:
@@ -229,7 +254,7 @@ private:
         hash_digest sequences;
     } hash_cache;
 
-    void initialize_hash_cache() const NOEXCEPT;
+    void initialize_hash_cache(bool witness) const NOEXCEPT;
 
     // Witness transaction signature caching.
     mutable std::unique_ptr<hash_cache> cache_;
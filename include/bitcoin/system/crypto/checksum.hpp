@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_CRYPTO_CHECKSUM_HPP
 
 /// DELETECSTDDEF
+#include <string>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/radix/radix.hpp>
@@ -52,6 +53,12 @@ void insert_checksum(data_array<Size>& data) NOEXCEPT;
 template <size_t Size, size_t Checksum = checksum_default_size>
 bool verify_checksum(const data_array<Size>& data) NOEXCEPT;
 
+/// Decode base58 of exactly Size bytes and verify the trailing checksum,
+/// without heap allocation (base58check, e.g. address, hd key).
+template <size_t Size, size_t Checksum = checksum_default_size>
+bool decode_base58_checked(data_array<Size>& out,
+    const std::string& in) NOEXCEPT;
+
 /// Append slices and a four byte bitcoin checksum.
 BC_API data_chunk append_checksum(const data_loaf& slices) NOEXCEPT;
 
@@ -88,6 +95,14 @@ BC_API bool bech32_verify_checked(uint8_t& out_version,
     data_chunk& out_program, const std::string& prefix,
     const base32_chunk& checked) NOEXCEPT;
 
+/// Low level bech32 checksum primitives, for callers that stream 5 bit values
+/// (e.g. bulk address encoding) without building base32 chunks. The checksum
+/// starts at bech32_prefix_polymod(prefix), accumulates each value (< 32) and
+/// six zeros (encode), and is finally compared to or xored by the constant.
+BC_API uint32_t bech32_polymod(uint32_t checksum, uint8_t value) NOEXCEPT;
+BC_API uint32_t bech32_prefix_polymod(const std::string& prefix) NOEXCEPT;
+BC_API uint32_t bech32_constant(uint8_t version) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
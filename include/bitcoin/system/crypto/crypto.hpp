@@ -28,6 +28,8 @@
 #include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/crypto/pseudo_random.hpp>
 #include <bitcoin/system/crypto/ring_signature.hpp>
+#include <bitcoin/system/crypto/scrypt_context.hpp>
+#include <bitcoin/system/crypto/sha256_hasher.hpp>
 #include <bitcoin/system/crypto/siphash.hpp>
 
 #endif
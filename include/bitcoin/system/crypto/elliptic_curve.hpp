@@ -102,6 +102,10 @@ BC_API bool ec_add(ec_compressed& left, const ec_compressed& right) NOEXCEPT;
 /// Compute the sum a += b.
 BC_API bool ec_add(ec_compressed& left, const ec_uncompressed& right) NOEXCEPT;
 
+/// Compute the sums out[i] = a + G * b[i], parsing a once.
+BC_API bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT;
+
 /// Compute the sum of compressed point values.
 BC_API bool ec_sum(ec_compressed& out, const compressed_list& values) NOEXCEPT;
 
@@ -150,6 +154,17 @@ BC_API bool secret_to_public(ec_compressed& out,
 BC_API bool secret_to_public(ec_uncompressed& out,
     const ec_secret& secret) NOEXCEPT;
 
+/// Convert secrets to compressed points, in parallel chunks where available.
+/// False if any secret is invalid.
+BC_API bool secret_to_public(compressed_list& out,
+    const secret_list& secrets) NOEXCEPT;
+
+/// Convert count consecutive secrets (first + index, modulo the curve order)
+/// to compressed points. Each chunk multiplies only its first secret and then
+/// adds the generator to obtain each following point. False if any is zero.
+BC_API bool secret_to_public_range(compressed_list& out,
+    const ec_secret& first, size_t count) NOEXCEPT;
+
 // Verify keys
 // ----------------------------------------------------------------------------
 
@@ -200,6 +215,11 @@ BC_API bool encode_signature(der_signature& out,
 BC_API bool sign(ec_signature& out, const ec_secret& secret,
     const hash_digest& hash) NOEXCEPT;
 
+/// Create an ECDSA signature with the RFC6979 nonce hedged by entropy.
+/// The signature is deterministic only for the same entropy.
+BC_API bool sign(ec_signature& out, const ec_secret& secret,
+    const hash_digest& hash, const hash_digest& entropy) NOEXCEPT;
+
 /// Verify an EC signature using a potential point.
 BC_API bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT;
@@ -221,6 +241,26 @@ BC_API bool recover_public(ec_uncompressed& out,
     const recoverable_signature& recoverable,
     const hash_digest& hash) NOEXCEPT;
 
+// Signing context
+// ----------------------------------------------------------------------------
+
+/// Refresh the side channel blinding of the calling thread's signing context.
+/// Blinding is otherwise refreshed periodically, this does not affect results.
+BC_API bool ec_randomize_context() NOEXCEPT;
+
+/// Source of blinding seeds, true if out is filled (pseudo_random::entropy).
+typedef bool(*ec_entropy)(const data_slab& out) NOEXCEPT;
+
+/// Set the blinding seed source of the calling thread's signing context and
+/// refresh its blinding from that source. If the source fails the blinding is
+/// unchanged, and is not attempted again until the next periodic refresh.
+/// The source reverts to the default when the context is released.
+BC_API bool ec_randomize_context(ec_entropy source) NOEXCEPT;
+
+/// Destroy the calling thread's signing context (otherwise on thread exit).
+/// A new context is created and blinded upon the thread's next signing use.
+BC_API void ec_release_context() NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -44,4 +44,38 @@ int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
     const uint8_t* salt, size_t salt_length, uint64_t N, uint32_t r,
     uint32_t p, uint8_t* buf, size_t buf_length);
 
+/**
+ * crypto_scrypt_threads(p):
+ * Return the default number of threads for p lanes (bounded by the number
+ * of parallel_for threads).
+ * Each thread requires its own V (128 * r * N bytes), so working memory is
+ * multiplied by the thread count (BIP38 with 8 threads: 16 MiB => 128 MiB).
+ * crypto_scrypt falls back to a single thread if the allocation fails.
+ */
+uint32_t crypto_scrypt_threads(uint32_t p);
+
+/**
+ * crypto_scrypt_sizes(N, r, p, threads, B_length, XY_length, V_length):
+ * Compute the working memory sizes required by crypto_scrypt_buffers. Each
+ * thread requires its own XY and V, so memory is proportional to threads.
+ *
+ * Return 0 on success; or -1 on error.
+ */
+int crypto_scrypt_sizes(uint64_t N, uint32_t r, uint32_t p, uint32_t threads,
+    size_t* B_length, size_t* XY_length, size_t* V_length);
+
+/**
+ * crypto_scrypt_buffers(passwd, passwdlen, salt, saltlen, N, r, p, buf,
+ *     buflen, threads, B, XY, V):
+ * Compute scrypt as crypto_scrypt, with the p lanes distributed over up to
+ * threads (parallel_for) workers, using caller provided (and so reusable)
+ * working memory of at least the sizes given by crypto_scrypt_sizes.
+ *
+ * Return 0 on success; or -1 on error.
+ */
+int crypto_scrypt_buffers(const uint8_t* passphrase, size_t passphrase_length,
+    const uint8_t* salt, size_t salt_length, uint64_t N, uint32_t r,
+    uint32_t p, uint8_t* buf, size_t buf_length, uint32_t threads,
+    uint8_t* B, uint8_t* XY, uint8_t* V);
+
 #endif /* !_CRYPTO_SCRYPT_H_ */
@@ -47,5 +47,7 @@ void SHA512(const uint8_t* input, size_t length,
 void SHA512Init(SHA512CTX* context);
 void SHA512Update(SHA512CTX* context, const uint8_t* input, size_t length);
 void SHA512Final(SHA512CTX* context, uint8_t digest[SHA512_DIGEST_LENGTH]);
+void SHA512Transform(uint64_t state[SHA512_STATE_LENGTH],
+    const uint8_t block[SHA512_BLOCK_LENGTH]);
 
 #endif
@@ -133,6 +133,10 @@ BC_API bool hash_reduce(std::vector<hash_digest>& hashes) NOEXCEPT;
 /// Generate a bitcoin short hash.
 BC_API short_hash bitcoin_short_hash(const data_slice& data) NOEXCEPT;
 
+/// Generate bitcoin short hashes of independent messages (e.g. public keys).
+BC_API short_hash_list bitcoin_short_hashes(
+    const std::vector<data_slice>& data) NOEXCEPT;
+
 /// Generate a ripemd160 hash.
 BC_API short_hash ripemd160_hash(const data_slice& data) NOEXCEPT;
 BC_API data_chunk ripemd160_hash_chunk(const data_slice& data) NOEXCEPT;
@@ -174,8 +178,29 @@ BC_API data_chunk scrypt_chunk(const data_slice& data, const data_slice& salt,
     size_t length) NOEXCEPT;
 
 /// DJB2 hash key algorithm by Dan Bernstein.
+/// Used for variable length keys (data_chunk), see array_hash for arrays.
 BC_API size_t djb2_hash(const data_slice& data) NOEXCEPT;
 
+/// Word-wise non-cryptographic hash of a fixed size array (table key).
+/// Well-distributed for uniformly random keys (digests, txids, points).
+/// Salt with hash_salt() to resist precomputed bucket collision attacks.
+template <size_t Size>
+inline size_t array_hash(const data_array<Size>& data,
+    uint64_t salt=zero) NOEXCEPT;
+
+/// Random value (os random device), fixed for the process, for array_hash.
+BC_API uint64_t hash_salt() NOEXCEPT;
+
+/// Salted array_hash functor, for unordered containers of exposed keys.
+struct salted_array_hash
+{
+    template <size_t Size>
+    inline size_t operator()(const data_array<Size>& data) const NOEXCEPT
+    {
+        return array_hash(data, hash_salt());
+    }
+};
+
 /// Combine hash values, such as a pair of djb2_hash outputs.
 constexpr size_t hash_combine(size_t left, size_t right) NOEXCEPT
 {
@@ -185,7 +210,7 @@ constexpr size_t hash_combine(size_t left, size_t right) NOEXCEPT
 } // namespace system
 } // namespace libbitcoin
 
-// Extend std and boost namespaces with djb2_hash.
+// Extend std and boost namespaces with djb2_hash/array_hash.
 // ----------------------------------------------------------------------------
 // This allows data_array/chunk to be incorporated into std/boost hash tables.
 
@@ -205,7 +230,7 @@ struct hash<bc::system::data_array<Size>>
 {
     size_t operator()(const bc::system::data_array<Size>& data) const NOEXCEPT
     {
-        return bc::system::djb2_hash(data);
+        return bc::system::array_hash(data);
     }
 };
 } // namespace std
@@ -226,7 +251,7 @@ struct hash<bc::system::data_array<Size>>
 {
     size_t operator()(const bc::system::data_array<Size>& data) const  NOEXCEPT
     {
-        return bc::system::djb2_hash(data);
+        return bc::system::array_hash(data);
     }
 };
 } // namespace boost
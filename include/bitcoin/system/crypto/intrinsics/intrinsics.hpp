@@ -37,6 +37,14 @@ constexpr std::array<uint32_t, 8> sha256_initial
     0x1f83d9ab_u32, 0x5be0cd19_u32
 };
 
+constexpr std::array<uint64_t, 8> sha512_initial
+{
+    0x6a09e667f3bcc908_u64, 0xbb67ae8584caa73b_u64,
+    0x3c6ef372fe94f82b_u64, 0xa54ff53a5f1d36f1_u64,
+    0x510e527fade682d1_u64, 0x9b05688c2b3e6c1f_u64,
+    0x1f83d9abfb41bd6b_u64, 0x5be0cd19137e2179_u64
+};
+
 struct sha256_context
 {
     std::array<uint32_t, 8> state{ sha256_initial };
@@ -83,6 +91,29 @@ constexpr std::array<uint8_t, 64> sha256x2_buffer
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00  // <=
 };
 
+/// Hash kernel families, automatic selects from those the CPU supports.
+enum class kernel
+{
+    automatic,
+    portable,
+    shani,
+    avx512,
+    avx2,
+    sse41,
+    neon,
+    sse4
+};
+
+/// Hash kernels are resolved once, on first use, from the BC_INTRINSICS
+/// environment variable (e.g. "portable") if set, otherwise automatically.
+/// Automatic resolution times the sse41/avx2 single transforms against
+/// portable, once per process, and uses each only if clearly faster.
+/// Forcing a family (for testing or benchmarking) fails if it is unavailable.
+/// The family may be changed while other threads are hashing (each completes
+/// its current call with the previous family).
+BC_API bool set_kernel(kernel family) NOEXCEPT;
+BC_API kernel get_kernel() NOEXCEPT;
+
 BC_API void sha256_x1_portable(uint32_t state[8], const uint8_t block[64]) NOEXCEPT;
 BC_API void sha256_update(sha256_context& context, const uint8_t input[], size_t size) NOEXCEPT;
 BC_API void sha256_pad(sha256_context& context) NOEXCEPT;
@@ -93,6 +124,35 @@ BC_API void sha256_single(uint32_t state[8], const uint8_t block[64]) NOEXCEPT;
 BC_API void sha256_paired_double(uint8_t out[], const uint8_t in[], size_t blocks) NOEXCEPT;
 BC_API void double_sha256_x1_portable(uint8_t out[], const uint8_t in[1 * 64]) NOEXCEPT;
 
+/// Independent messages of any size, hashed into count contiguous digests.
+/// Compression rounds are interleaved across SIMD lanes where available.
+BC_API void sha256_multiple(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT;
+BC_API void double_sha256_multiple(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT;
+
+BC_API void ripemd160(const uint8_t input[], size_t size, uint8_t digest[20]) NOEXCEPT;
+BC_API void sha512(const uint8_t input[], size_t size, uint8_t digest[64]) NOEXCEPT;
+BC_API void sha512_x1_portable(uint64_t state[8], const uint8_t block[128]) NOEXCEPT;
+BC_API void sha512_single(uint64_t state[8], const uint8_t block[128]) NOEXCEPT;
+
+/// Independent messages of any size, hashed (sha256 then ripemd160) into count
+/// contiguous short hashes. Both stages are interleaved across SIMD lanes.
+BC_API void hash160_multiple(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT;
+
+/// Scan count nonces (wrapping) from first, within the 80 byte header, for a
+/// double sha256 (as a little endian integer) at or below the little endian
+/// target. The first header block is compressed once, and nonces are tested
+/// across SIMD lanes where available. False if none found.
+BC_API bool sha256_nonce_scan(uint32_t& nonce, const uint8_t header[80],
+    uint32_t first, uint32_t count, const uint8_t target[32]) NOEXCEPT;
+
+/// Independent messages of any size, siphash-2-4 (one key {k0, k1}) into count
+/// contiguous values. Messages are interleaved across SIMD lanes where available.
+BC_API void siphash_multiple(uint64_t out[], const uint64_t key[2],
+    const uint8_t* const in[], const size_t sizes[], size_t count) NOEXCEPT;
+
 } // namespace intrinsics
 } // namespace system
 } // namespace libbitcoin
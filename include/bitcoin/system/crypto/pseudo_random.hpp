@@ -49,6 +49,11 @@ class BC_API pseudo_random
     /// Fill a byte vector with randomness using the default random engine.
     static void fill(data_chunk& out) NOEXCEPT;
 
+    /// Fill bytes from the operating system random device.
+    /// Use where predictability matters, the twister is clock seeded.
+    /// Returns false if the device is unavailable (out is unchanged).
+    static bool entropy(const data_slab& out) NOEXCEPT;
+
     /// Generate a pseudo random number within the uint8_t domain.
     /// Specialized: uniform_int_distribution is undefined for sizes < 16 bits.
     static uint8_t next() NOEXCEPT;
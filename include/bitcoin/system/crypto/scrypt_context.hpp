@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SCRYPT_CONTEXT_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SCRYPT_CONTEXT_HPP
+
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Reusable scrypt working memory, for hashing many passphrases (e.g. bulk
+/// BIP38 encryption/decryption) without reallocating per call. The
+/// parallelism (p) lanes of each hash are distributed across threads, and
+/// each thread requires 128 * work * resources bytes. Buffers only grow.
+/// Not thread safe, use one context per calling thread.
+class BC_API scrypt_context
+{
+public:
+    /// Zero threads implies the number of hardware threads (per hash).
+    scrypt_context(size_t threads=zero) NOEXCEPT;
+
+    /// Generate a scrypt hash of specified length.
+    /// Returns zeroized hash on invalid parameterization or allocation
+    /// (a single thread is retried if the parallel allocation fails).
+    data_chunk hash(const data_slice& data, const data_slice& salt,
+        uint64_t work, uint32_t resources, uint32_t parallelism,
+        size_t length) NOEXCEPT;
+
+    /// Generate a scrypt hash to fill a byte array.
+    template <size_t Size>
+    inline data_array<Size> hash(const data_slice& data,
+        const data_slice& salt, uint64_t work, uint32_t resources,
+        uint32_t parallelism) NOEXCEPT
+    {
+        data_array<Size> out{};
+        compute(out.data(), out.size(), data, salt, work, resources,
+            parallelism);
+        return out;
+    }
+
+    /// Release the working memory.
+    void clear() NOEXCEPT;
+
+private:
+    bool compute(uint8_t* out, size_t length, const data_slice& data,
+        const data_slice& salt, uint64_t work, uint32_t resources,
+        uint32_t parallelism) NOEXCEPT;
+    bool reserve(uint32_t threads, uint64_t work, uint32_t resources,
+        uint32_t parallelism) NOEXCEPT;
+
+    const size_t threads_;
+    data_chunk block_;
+    data_chunk scratch_;
+    data_chunk vector_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
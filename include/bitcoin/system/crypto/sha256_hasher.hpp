@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SHA256_HASHER_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SHA256_HASHER_HPP
+
+#include <array>
+#include <bitcoin/system/crypto/hash.hpp>
+#include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Incremental sha256, copyable so that a common prefix (e.g. a BIP143
+/// preimage prefix or a header prefix) can be hashed once and resumed from
+/// any number of times. Finalization does not modify the hasher.
+class BC_API sha256_hasher
+{
+public:
+    /// Block-aligned chaining state, for export/import of a prefix.
+    struct midstate
+    {
+        std::array<uint32_t, 8> state;
+        uint64_t blocks;
+    };
+
+    /// Defaults.
+    sha256_hasher(sha256_hasher&&) = default;
+    sha256_hasher(const sha256_hasher&) = default;
+    sha256_hasher& operator=(sha256_hasher&&) = default;
+    sha256_hasher& operator=(const sha256_hasher&) = default;
+    ~sha256_hasher() = default;
+
+    /// Start a new hash.
+    sha256_hasher() NOEXCEPT;
+
+    /// Resume from an exported midstate.
+    sha256_hasher(const midstate& state) NOEXCEPT;
+
+    /// Hash more data.
+    sha256_hasher& update(const data_slice& data) NOEXCEPT;
+
+    /// The sha256 hash of all data, hasher is unchanged.
+    hash_digest finalize() const NOEXCEPT;
+
+    /// The double sha256 (bitcoin) hash of all data, hasher is unchanged.
+    hash_digest finalize_double() const NOEXCEPT;
+
+    /// Export the chaining state, false if data is not block-aligned.
+    bool export_midstate(midstate& out) const NOEXCEPT;
+
+    /// The number of bytes hashed.
+    uint64_t size() const NOEXCEPT;
+
+    /// Clear the hasher to start a new hash.
+    void reset() NOEXCEPT;
+
+private:
+    intrinsics::sha256_context context_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -23,6 +23,7 @@
 #define LIBBITCOIN_SYSTEM_CRYPTO_SIPHASH
 
 #include <tuple>
+#include <vector>
 #include <bitcoin/system/crypto/hash.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -38,6 +39,10 @@ BC_API uint64_t siphash(const half_hash& hash,
 BC_API uint64_t siphash(const siphash_key& key,
     const data_slice& message) NOEXCEPT;
 
+/// Hash each message with the same key (SIMD lanes, and parallel when large).
+BC_API std::vector<uint64_t> siphash_batch(const siphash_key& key,
+    const data_stack& messages) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
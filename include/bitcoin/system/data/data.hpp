@@ -30,6 +30,9 @@
 #include <bitcoin/system/data/external_ptr.hpp>
 #include <bitcoin/system/data/memory.hpp>
 #include <bitcoin/system/data/no_fill_allocator.hpp>
+#include <bitcoin/system/data/object_pool.hpp>
+#include <bitcoin/system/data/open_set.hpp>
+#include <bitcoin/system/data/parallel.hpp>
 #include <bitcoin/system/data/string.hpp>
 
 #endif
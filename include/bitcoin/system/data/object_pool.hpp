@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_OBJECT_POOL_HPP
+#define LIBBITCOIN_SYSTEM_DATA_OBJECT_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Thread-static recycling of small allocations (size-class free lists).
+/// Retention is per thread and defaults to zero, in which case allocation is
+/// passed through to the global operator new/delete. A thread that churns
+/// chain objects (e.g. mempool relay) may set a retention bound, so that
+/// freed blocks are reused by that thread without allocator contention.
+/// Blocks may be freed on any thread, in which case they are recycled (or
+/// released) by the freeing thread. Retained blocks are released on trim
+/// and when the thread terminates.
+class BC_API object_pool
+{
+public:
+    /// Blocks are rounded up to granularity (fundamental alignment).
+    static constexpr size_t granularity = alignof(std::max_align_t);
+
+    /// Larger allocations are not pooled.
+    static constexpr size_t size_classes = 16;
+    static constexpr size_t maximum_size = granularity * size_classes;
+
+    /// Allocate a block of at least bytes (THROWS std::bad_alloc).
+    static void* allocate(size_t bytes) THROWS;
+
+    /// Free a block of the allocated bytes, recycled if within retention.
+    static void deallocate(void* block, size_t bytes) NOEXCEPT;
+
+    /// Maximum number of blocks retained per size class (this thread).
+    static size_t retention() NOEXCEPT;
+    static void set_retention(size_t blocks) NOEXCEPT;
+
+    /// Number of blocks currently retained (this thread).
+    static size_t retained() NOEXCEPT;
+
+    /// Release all retained blocks (this thread).
+    static void trim() NOEXCEPT;
+};
+
+/// Stateless std allocator over object_pool.
+/// Types requiring extended alignment are not supported.
+template <typename Type>
+class pool_allocator
+{
+public:
+    static_assert(alignof(Type) <= object_pool::granularity);
+    using value_type = Type;
+
+    pool_allocator() NOEXCEPT = default;
+
+    template <typename Other>
+    pool_allocator(const pool_allocator<Other>&) NOEXCEPT
+    {
+    }
+
+    Type* allocate(size_t count) THROWS
+    {
+        BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+        return reinterpret_cast<Type*>(
+            object_pool::allocate(count * sizeof(Type)));
+        BC_POP_WARNING()
+    }
+
+    void deallocate(Type* ptr, size_t count) NOEXCEPT
+    {
+        object_pool::deallocate(ptr, count * sizeof(Type));
+    }
+
+    template <typename Other>
+    bool operator==(const pool_allocator<Other>&) const NOEXCEPT
+    {
+        return true;
+    }
+
+    template <typename Other>
+    bool operator!=(const pool_allocator<Other>&) const NOEXCEPT
+    {
+        return false;
+    }
+};
+
+/// Create shared pointer to const, with the instance and control block in a
+/// single pooled allocation.
+template <typename Type, typename ...Args>
+inline std::shared_ptr<const Type> to_pooled(Args&&... args) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    return std::allocate_shared<Type>(pool_allocator<Type>{},
+        std::forward<Args>(args)...);
+    BC_POP_WARNING()
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
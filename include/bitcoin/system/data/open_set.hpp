@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_OPEN_SET_HPP
+#define LIBBITCOIN_SYSTEM_DATA_OPEN_SET_HPP
+
+#include <functional>
+#include <vector>
+#include <bitcoin/system/data/no_fill_allocator.hpp>
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Insert-only open addressing (linear probe) hash set of fixed capacity.
+/// The table is allocated once at construction, sized to twice the expected
+/// element count (rounded to a power of two), so no rehashing or per-element
+/// allocation occurs. Intended for short-lived uniqueness checks over keys
+/// with uniformly-distributed hashes (e.g. txids and points).
+template <typename Key, typename Hash = std::hash<Key>,
+    typename Equal = std::equal_to<Key>>
+class open_set
+{
+public:
+    /// Defaults.
+    open_set(open_set&&) = default;
+    open_set(const open_set&) = default;
+    open_set& operator=(open_set&&) = default;
+    open_set& operator=(const open_set&) = default;
+    ~open_set() = default;
+
+    /// Size the table for up to 'count' elements at no more than half load.
+    inline open_set(size_t count, const Hash& hash={},
+        const Equal& equal={}) NOEXCEPT;
+
+    /// Insert a copy of the key, false if already present (or table full).
+    inline bool insert(const Key& key) NOEXCEPT;
+
+    /// True if the key is present.
+    inline bool contains(const Key& key) const NOEXCEPT;
+
+    /// The number of elements in the set.
+    inline size_t size() const NOEXCEPT;
+
+    /// True if the set has no elements.
+    inline bool empty() const NOEXCEPT;
+
+    /// The number of buckets in the table (fixed).
+    inline size_t capacity() const NOEXCEPT;
+
+private:
+    inline size_t find(const Key& key) const NOEXCEPT;
+
+    Hash hash_;
+    Equal equal_;
+    size_t mask_;
+    size_t size_;
+    std::vector<bool> used_;
+    std::vector<Key, no_fill_allocator<Key>> keys_;
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/data/open_set.ipp>
+
+#endif
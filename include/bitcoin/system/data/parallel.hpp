@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_PARALLEL_HPP
+#define LIBBITCOIN_SYSTEM_DATA_PARALLEL_HPP
+
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Type erased range invocation for parallel_dispatch.
+typedef void(*parallel_range)(const void* context, size_t index);
+
+/// The number of threads available to parallel_dispatch (including caller).
+BC_API size_t parallel_threads() NOEXCEPT;
+
+/// Invoke range(context, index) for each index in [0, ranges) over a process
+/// wide pool of persistent worker threads and the calling thread. Dispatch
+/// from a pool thread, or while the pool is in use, runs on the caller.
+BC_API void parallel_dispatch(size_t ranges, parallel_range range,
+    const void* context) NOEXCEPT;
+
+/// Invoke function(index) for each index in [0, count). Contiguous index
+/// ranges are distributed over the worker pool (see parallel_dispatch).
+/// A single index is invoked inline, without pool synchronization.
+/// This does not depend upon C++17 execution policy support (not portable).
+template <typename Function>
+inline void parallel_for(size_t count, const Function& function) NOEXCEPT;
+
+/// True if predicate(index) is true for each index in [0, count), evaluated
+/// as parallel_for. Once any is false remaining indexes are not evaluated.
+template <typename Predicate>
+inline bool parallel_all_of(size_t count, const Predicate& predicate) NOEXCEPT;
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/data/parallel.ipp>
+
+#endif
@@ -97,6 +97,7 @@ namespace bc = libbitcoin;
 // These are defined in the GUI for VS builds and by command line for others.
 // But overriding these here for VS builds to keep tests active.
 #if !defined(HAVE_PORTABLE) && defined(HAVE_MSC) && defined(HAVE_X64)
+    #define WITH_AVX512
     #define WITH_AVX2
     #define WITH_SSE41
     #define WITH_SSE4
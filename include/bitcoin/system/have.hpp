@@ -84,6 +84,12 @@
     #define HAVE_ITANIUM
 #endif
 
+// SSE2 is baseline for x64 targets (and otherwise enabled by the compiler).
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define HAVE_SSE2
+#endif
+
 // Other platforms not as far with C++ 20.
 #if defined(HAVE_MSC) && defined(HAVE_CPP20)
     #define HAVE_RANGES
@@ -47,9 +47,8 @@ void insert_checksum(data_array<Size>& data) NOEXCEPT
     const auto payload_begin = data.begin();
     const auto payload_end = std::prev(data.end(), Checksum);
 
-    // Compute the bitcoin hash.
-    const auto payload = data_chunk{ payload_begin, payload_end };
-    const auto payload_hash = bitcoin_hash(payload);
+    // Compute the bitcoin hash (of a slice, no copy).
+    const auto payload_hash = bitcoin_hash({ payload_begin, payload_end });
 
     // Obtain the hash checksum iterators.
     const auto check_begin = payload_hash.begin();
@@ -69,9 +68,8 @@ bool verify_checksum(const data_array<Size>& data) NOEXCEPT
     const auto payload_begin = data.begin();
     const auto payload_end = std::prev(data.end(), Checksum);
 
-    // Compute the bitcoin hash.
-    const auto payload = data_chunk{ payload_begin, payload_end };
-    const auto payload_hash = bitcoin_hash(payload);
+    // Compute the bitcoin hash (of a slice, no copy).
+    const auto payload_hash = bitcoin_hash({ payload_begin, payload_end });
 
     // Obtain the hash checksum iterators.
     const auto check_begin = payload_hash.begin();
@@ -81,6 +79,13 @@ bool verify_checksum(const data_array<Size>& data) NOEXCEPT
     return std::equal(check_begin, check_end, payload_end);
 }
 
+template <size_t Size, size_t Checksum>
+bool decode_base58_checked(data_array<Size>& out,
+    const std::string& in) NOEXCEPT
+{
+    return decode_base58(out, in) && verify_checksum<Size, Checksum>(out);
+}
+
 } // namespace system
 } // namespace libbitcoin
 
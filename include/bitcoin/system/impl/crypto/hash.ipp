@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -34,6 +36,41 @@ inline data_array<Size> scrypt(const data_slice& data, const data_slice& salt,
         parallelism, Size));
 }
 
+// Multiply-xor over native words, with a final fold of the high product bits
+// into the low (bucket selection) bits. Reads Size/8 words, not Size bytes.
+template <size_t Size>
+inline size_t array_hash(const data_array<Size>& data, uint64_t salt) NOEXCEPT
+{
+    // 2^64 / golden ratio (odd), as used in Fibonacci hashing.
+    constexpr auto multiplier = 0x9e3779b97f4a7c15_u64;
+    constexpr auto word_size = sizeof(uint64_t);
+    constexpr auto words = Size / word_size;
+    constexpr auto tail = Size % word_size;
+
+    auto hash = bit_xor(salt, possible_narrow_cast<uint64_t>(Size));
+
+    if constexpr (!is_zero(words))
+    {
+        const auto& integrals = unsafe_array_cast<uint64_t, words>(
+            data.data());
+
+        for (const auto integral: integrals)
+            hash = bit_xor(hash, native_from_little_end(integral)) *
+                multiplier;
+    }
+
+    if constexpr (!is_zero(tail))
+    {
+        auto last = 0_u64;
+        for (auto byte = Size - tail; byte < Size; ++byte)
+            last = bit_or(shift_left(last, byte_bits), uint64_t{ data[byte] });
+
+        hash = bit_xor(hash, last) * multiplier;
+    }
+
+    return possible_narrow_cast<size_t>(bit_xor(hash, shift_right(hash, 32)));
+}
+
 } // namespace system
 } // namespace libbitcoin
 
@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_OPEN_SET_IPP
+#define LIBBITCOIN_SYSTEM_DATA_OPEN_SET_IPP
+
+#include <functional>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// power2(bit_width(count) + 1) > 2 * count, so load is always below one half.
+template <typename Key, typename Hash, typename Equal>
+inline open_set<Key, Hash, Equal>::open_set(size_t count, const Hash& hash,
+    const Equal& equal) NOEXCEPT
+  : hash_(hash),
+    equal_(equal),
+    mask_(sub1(power2(add1(ceilinged_log2(count))))),
+    size_(zero),
+    used_(add1(mask_), false),
+    keys_(add1(mask_))
+{
+}
+
+BC_POP_WARNING()
+
+template <typename Key, typename Hash, typename Equal>
+inline bool open_set<Key, Hash, Equal>::insert(const Key& key) NOEXCEPT
+{
+    const auto bucket = find(key);
+    if (bucket == capacity() || used_[bucket])
+        return false;
+
+    used_[bucket] = true;
+    keys_[bucket] = key;
+    ++size_;
+    return true;
+}
+
+template <typename Key, typename Hash, typename Equal>
+inline bool open_set<Key, Hash, Equal>::contains(const Key& key) const NOEXCEPT
+{
+    const auto bucket = find(key);
+    return bucket != capacity() && used_[bucket];
+}
+
+template <typename Key, typename Hash, typename Equal>
+inline size_t open_set<Key, Hash, Equal>::size() const NOEXCEPT
+{
+    return size_;
+}
+
+template <typename Key, typename Hash, typename Equal>
+inline bool open_set<Key, Hash, Equal>::empty() const NOEXCEPT
+{
+    return is_zero(size_);
+}
+
+template <typename Key, typename Hash, typename Equal>
+inline size_t open_set<Key, Hash, Equal>::capacity() const NOEXCEPT
+{
+    return keys_.size();
+}
+
+// private
+// Returns the bucket of the key, or the first empty bucket in its probe
+// sequence, or capacity() if the table is full and the key is not present.
+template <typename Key, typename Hash, typename Equal>
+inline size_t open_set<Key, Hash, Equal>::find(const Key& key) const NOEXCEPT
+{
+    auto bucket = hash_(key) & mask_;
+
+    for (size_t probe = zero; probe < capacity(); ++probe)
+    {
+        if (!used_[bucket] || equal_(keys_[bucket], key))
+            return bucket;
+
+        bucket = add1(bucket) & mask_;
+    }
+
+    return capacity();
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_DATA_PARALLEL_IPP
+#define LIBBITCOIN_SYSTEM_DATA_PARALLEL_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+template <typename Function>
+inline void parallel_for(size_t count, const Function& function) NOEXCEPT
+{
+    const auto threads = count > one ?
+        std::min(count, parallel_threads()) : count;
+
+    if (threads <= one)
+    {
+        for (auto index = zero; index < count; ++index)
+            function(index);
+
+        return;
+    }
+
+    const auto size = ceilinged_divide(count, threads);
+    const auto range = [&](size_t thread) NOEXCEPT
+    {
+        const auto last = std::min(count, add1(thread) * size);
+        for (auto index = thread * size; index < last; ++index)
+            function(index);
+    };
+
+    using range_type = decltype(range);
+    parallel_dispatch(threads, [](const void* context, size_t thread) NOEXCEPT
+    {
+        (*static_cast<const range_type*>(context))(thread);
+    }, &range);
+}
+
+template <typename Predicate>
+inline bool parallel_all_of(size_t count, const Predicate& predicate) NOEXCEPT
+{
+    std::atomic_bool success{ true };
+    parallel_for(count, [&](size_t index) NOEXCEPT
+    {
+        if (success.load(std::memory_order_relaxed) && !predicate(index))
+            success.store(false, std::memory_order_relaxed);
+    });
+
+    return success.load();
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
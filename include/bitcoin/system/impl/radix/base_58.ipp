@@ -19,7 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_RADIX_BASE_58_IPP
 #define LIBBITCOIN_SYSTEM_RADIX_BASE_58_IPP
 
-#include <algorithm>
+#include <string>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 
@@ -27,14 +27,15 @@ namespace libbitcoin {
 namespace system {
 
 template <size_t Size>
-bool decode_base58(data_array<Size>& out, const std::string& in) NOEXCEPT
+std::string encode_base58(const data_array<Size>& unencoded) NOEXCEPT
 {
-    data_chunk data;
-    if (!decode_base58(data, in) || (data.size() != Size))
-        return false;
+    return encode_base58(data_slice{ unencoded });
+}
 
-    std::copy(data.begin(), data.end(), out.begin());
-    return true;
+template <size_t Size>
+bool decode_base58(data_array<Size>& out, const std::string& in) NOEXCEPT
+{
+    return decode_base58(data_slab{ out }, in);
 }
 
 // TODO: determine if the sizing function is always accurate.
@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_KEYS_HD_CACHE_IPP
+#define LIBBITCOIN_SYSTEM_WALLET_KEYS_HD_CACHE_IPP
+
+#include <iterator>
+#include <utility>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/wallet/keys/hd_private.hpp>
+#include <bitcoin/system/wallet/keys/hd_public.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+template <typename Key>
+hd_cache<Key>::hd_cache(const Key& root, size_t capacity) NOEXCEPT
+  : root_(root), capacity_(capacity)
+{
+}
+
+// Nodes are derived from the deepest cached ancestor of the leaf's parent,
+// caching each (parent) node derived along the way.
+template <typename Key>
+Key hd_cache<Key>::derive(const hd_path& path) NOEXCEPT
+{
+    if (path.empty())
+        return root_;
+
+    const auto leaf = sub1(path.size());
+    auto depth = leaf;
+    const Key* parent = nullptr;
+
+    for (; is_nonzero(depth); --depth)
+    {
+        parent = find(prefix(path, depth));
+        if (!is_null(parent))
+            break;
+    }
+
+    if (is_null(parent))
+        parent = &root_;
+
+    for (; depth < leaf; ++depth)
+    {
+        auto child = derive_child(*parent, path[depth]);
+        if (!child)
+            return {};
+
+        parent = &store(prefix(path, add1(depth)), std::move(child));
+    }
+
+    return derive_child(*parent, path[leaf]);
+}
+
+template <typename Key>
+const Key& hd_cache<Key>::root() const NOEXCEPT
+{
+    return root_;
+}
+
+template <typename Key>
+size_t hd_cache<Key>::size() const NOEXCEPT
+{
+    return nodes_.size();
+}
+
+template <typename Key>
+void hd_cache<Key>::clear() NOEXCEPT
+{
+    index_.clear();
+    nodes_.clear();
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+template <>
+inline hd_private hd_cache<hd_private>::derive_child(const hd_private& parent,
+    uint32_t child) NOEXCEPT
+{
+    return parent.derive_private(child);
+}
+
+template <>
+inline hd_public hd_cache<hd_public>::derive_child(const hd_public& parent,
+    uint32_t child) NOEXCEPT
+{
+    return parent.derive_public(child);
+}
+
+template <typename Key>
+hd_path hd_cache<Key>::prefix(const hd_path& path, size_t depth) NOEXCEPT
+{
+    return { path.begin(), std::next(path.begin(),
+        possible_narrow_and_sign_cast<ptrdiff_t>(depth)) };
+}
+
+// A hit moves the node to the front (most recently used).
+template <typename Key>
+const Key* hd_cache<Key>::find(const hd_path& path) NOEXCEPT
+{
+    const auto it = index_.find(path);
+    if (it == index_.end())
+        return nullptr;
+
+    nodes_.splice(nodes_.begin(), nodes_, it->second);
+    return &it->second->second;
+}
+
+// Storing evicts the least recently used node when at capacity. The stored
+// node is at the front, so it is never the one evicted.
+template <typename Key>
+const Key& hd_cache<Key>::store(const hd_path& path, Key&& key) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    nodes_.emplace_front(path, std::move(key));
+    index_[path] = nodes_.begin();
+    BC_POP_WARNING()
+
+    while (nodes_.size() > capacity_ && nodes_.size() > one)
+    {
+        index_.erase(nodes_.back().first);
+        nodes_.pop_back();
+    }
+
+    return nodes_.front().second;
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -23,6 +23,7 @@
 /// DELETECSTDDEF
 /// DELETECSTDINT
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -62,6 +63,48 @@ std::string dictionary<Size>::name() const NOEXCEPT
     return languages::to_name(identifier_);
 }
 
+// Hash table.
+// ----------------------------------------------------------------------------
+
+// private
+// FNV-1a (32 bit), sufficient to distribute a fixed set of short words.
+template <size_t Size>
+constexpr uint32_t dictionary<Size>::hash(const std::string_view& word) NOEXCEPT
+{
+    constexpr uint32_t offset = 0x811c9dc5;
+    constexpr uint32_t prime = 0x01000193;
+
+    auto value = offset;
+    for (const auto character: word)
+        value = (value ^ static_cast<uint8_t>(character)) * prime;
+
+    return value;
+}
+
+template <size_t Size>
+constexpr typename dictionary<Size>::words
+dictionary<Size>::hashed(const words& words) NOEXCEPT
+{
+    // Linear probing at load <= 1/2, words inserted in order. So a duplicate
+    // word is always probed after its first occurrence (first match).
+    auto out = words;
+    out.probes = zero;
+    out.table.fill(0);
+
+    for (size_t index = 0; index < Size; ++index)
+    {
+        size_t probes = one;
+        auto position = hash(words.word[index]) % slots;
+        for (; !is_zero(out.table[position]); ++probes)
+            position = add1(position) % slots;
+
+        out.table[position] = possible_narrow_cast<slot>(add1(index));
+        out.probes = std::max(out.probes, probes);
+    }
+
+    return out;
+}
+
 // Search.
 // ----------------------------------------------------------------------------
 
@@ -90,6 +133,26 @@ string_list dictionary<Size>::at(const search& indexes) const NOEXCEPT
 template <size_t Size>
 int32_t dictionary<Size>::index(const std::string& word) const NOEXCEPT
 {
+    // Catalogs are hashed at compile time, O(1) without string construction.
+    if (!is_zero(words_.probes))
+    {
+        auto position = hash(word) % slots;
+        for (size_t probe = 0; probe < words_.probes; ++probe)
+        {
+            const auto entry = words_.table[position];
+            if (is_zero(entry))
+                return -1;
+
+            const auto index = sub1(static_cast<size_t>(entry));
+            if (word == words_.word[index])
+                return possible_narrow_sign_cast<int32_t>(index);
+
+            position = add1(position) % slots;
+        }
+
+        return -1;
+    }
+
     // Dictionary sort is configured on each dictionary, verified by tests.
     // Dictionary is char* elements but using std::string (word) for compares.
     if (words_.sorted)
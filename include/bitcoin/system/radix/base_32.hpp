@@ -77,6 +77,12 @@ BC_API std::string encode_base32(const base32_chunk& data) NOEXCEPT;
 /// False if mixed case or any character is not from the base32 character set.
 BC_API bool decode_base32(base32_chunk& out, const std::string& in) NOEXCEPT;
 
+/// Map a 5 bit value (< 32) to its base32 character.
+BC_API char base32_character(uint8_t value) NOEXCEPT;
+
+/// Map a base32 character (either case) to its 5 bit value, 0xff if invalid.
+BC_API uint8_t base32_value(char character) NOEXCEPT;
+
 /// Pack any vector of 5 bit bytes to vector of 8 bit bytes.
 BC_API data_chunk base32_pack(const base32_chunk& unpacked) NOEXCEPT;
 
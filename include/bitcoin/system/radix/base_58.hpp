@@ -29,7 +29,13 @@ namespace system {
 BC_API bool is_base58(const char character) NOEXCEPT;
 BC_API bool is_base58(const std::string& text) NOEXCEPT;
 
-/// Converts a base58 string to a number of bytes.
+/// Encode a fixed size payload (e.g. address, wif, hd key) as base58.
+/// Conversion of a payload of this size is on the stack, only the result is
+/// allocated.
+template <size_t Size>
+std::string encode_base58(const data_array<Size>& unencoded) NOEXCEPT;
+
+/// Converts a base58 string to a number of bytes, without allocation.
 /// @return false if the input is malformed, or the wrong length.
 template <size_t Size>
 bool decode_base58(data_array<Size>& out, const std::string& in) NOEXCEPT;
@@ -42,10 +48,19 @@ data_array<Size * 733 / 1000> base58_array(const char(&string)[Size]) NOEXCEPT;
 /// @return the base58 encoded string.
 BC_API std::string encode_base58(const data_slice& unencoded) NOEXCEPT;
 
+/// Append the base58 encoding of data to out (no allocation if reserved).
+BC_API void append_base58(std::string& out,
+    const data_slice& unencoded) NOEXCEPT;
+
 /// Attempt to decode base58 data.
 /// @return false if the input contains non-base58 characters.
 BC_API bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT;
 
+/// Attempt to decode base58 data to exactly out.size() bytes (out is
+/// unchanged on failure). Conversion of typical payloads is on the stack.
+/// @return false if the input is malformed, or the wrong length.
+BC_API bool decode_base58(const data_slab& out, const std::string& in) NOEXCEPT;
+
 } // namespace system
 } // namespace libbitcoin
 
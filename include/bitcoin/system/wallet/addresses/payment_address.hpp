@@ -64,6 +64,16 @@ public:
         uint8_t p2kh_prefix=mainnet_p2kh,
         uint8_t p2sh_prefix=mainnet_p2sh) NOEXCEPT;
 
+    /// Bulk serializer, appends delimited addresses of hashes to out.
+    /// Checksums are hashed across SIMD lanes and out is reserved once.
+    static void encode(std::string& out, const short_hash_list& hashes,
+        uint8_t prefix=mainnet_p2kh, char delimiter='\n') NOEXCEPT;
+
+    /// Bulk parser, appends hashes of delimited addresses of prefix to out.
+    /// False if any address is invalid or has a different prefix.
+    static bool decode(short_hash_list& out, const std::string& addresses,
+        uint8_t prefix=mainnet_p2kh, char delimiter='\n') NOEXCEPT;
+
     /// Constructors.
     payment_address() NOEXCEPT;
     payment_address(payment_address&& other) NOEXCEPT;
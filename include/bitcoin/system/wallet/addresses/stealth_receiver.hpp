@@ -20,6 +20,8 @@
 #define LIBBITCOIN_SYSTEM_WALLET_ADDRESSES_STEALTH_RECEIVER_HPP
 
 /// DELETECSTDINT
+#include <vector>
+#include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -34,6 +36,17 @@ namespace wallet {
 class BC_API stealth_receiver
 {
 public:
+    /// A payment to this receiver, by position within a block.
+    struct payment
+    {
+        size_t transaction;
+        uint32_t stealth;
+        uint32_t output;
+        ec_compressed ephemeral_public;
+    };
+
+    typedef std::vector<payment> payments;
+
     /// Constructors.
     stealth_receiver(const ec_secret& scan_private,
         const ec_secret& spend_private, const binary& filter,
@@ -53,12 +66,24 @@ public:
     bool derive_private(ec_secret& out_private,
         const ec_compressed& ephemeral_public) const NOEXCEPT;
 
+    /// Find all payments to this receiver in the block. Stealth scripts are
+    /// matched to the filter by hash prefix before any EC operation, and the
+    /// shared secrets of matches are derived in parallel (where available).
+    /// A payment is a pay-key-hash output of the stealth script's transaction.
+    bool scan(payments& out, const chain::block& block) const NOEXCEPT;
+
 private:
+    bool is_filtered(const chain::script& script) const NOEXCEPT;
+
     const uint8_t version_;
     const ec_secret scan_private_;
     const ec_secret spend_private_;
     ec_compressed spend_public_;
     wallet::stealth_address address_;
+
+    // Filter precomputed as the leading bits of a big-endian prefix.
+    const uint32_t filter_mask_;
+    const uint32_t filter_value_;
 };
 
 } // namespace wallet
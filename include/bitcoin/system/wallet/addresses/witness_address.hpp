@@ -112,6 +112,17 @@ class BC_API witness_address
         uint8_t& out_version, data_chunk& out_program,
         const std::string& address, bool strict=false) NOEXCEPT;
 
+    /// Bulk serializer, appends delimited version 0 p2kh addresses to out.
+    /// Characters and checksums are streamed without base32 intermediates.
+    /// False if the prefix is invalid.
+    static bool encode(std::string& out, const short_hash_list& hashes,
+        const std::string& prefix=mainnet, char delimiter='\n') NOEXCEPT;
+
+    /// Bulk parser, appends hashes of delimited version 0 p2kh addresses.
+    /// False if any address is invalid or has a different prefix or program.
+    static bool decode(short_hash_list& out, const std::string& addresses,
+        const std::string& prefix=mainnet, char delimiter='\n') NOEXCEPT;
+
     /// Constructors.
     witness_address() NOEXCEPT;
     witness_address(witness_address&& other) NOEXCEPT;
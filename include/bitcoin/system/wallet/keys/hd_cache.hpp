@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_WALLET_KEYS_HD_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_WALLET_KEYS_HD_CACHE_HPP
+
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/wallet/keys/hd_private.hpp>
+#include <bitcoin/system/wallet/keys/hd_public.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+/// A BIP32 derivation path, child indexes from the root (hardened bit set).
+typedef std::vector<uint32_t> hd_path;
+
+/// Parse a path such as "m/84'/0'/0'/0/5" ("h" or "H" also mark hardened).
+BC_API bool decode_hd_path(hd_path& out, const std::string& text) NOEXCEPT;
+
+/// Serialize a path as "m/84'/0'/0'/0/5".
+BC_API std::string encode_hd_path(const hd_path& path) NOEXCEPT;
+
+/// Derives keys from a root (hd_private or hd_public) along paths, keeping
+/// parent (non-leaf) nodes in a bounded least recently used cache. Sibling
+/// leaves of a shared parent therefore derive only their own level. Leaves
+/// are not cached, so iterating leaves does not evict their parents.
+/// Not thread safe, use one cache per thread.
+template <typename Key>
+class hd_cache
+{
+public:
+    /// Capacity is the maximum number of cached parent nodes.
+    hd_cache(const Key& root, size_t capacity=1024) NOEXCEPT;
+
+    /// Derive the key at path, invalid if derivation fails (e.g. a hardened
+    /// index from a public root).
+    Key derive(const hd_path& path) NOEXCEPT;
+
+    /// The root key.
+    const Key& root() const NOEXCEPT;
+
+    /// The number of cached nodes.
+    size_t size() const NOEXCEPT;
+
+    /// Discard all cached nodes.
+    void clear() NOEXCEPT;
+
+private:
+    typedef std::list<std::pair<hd_path, Key>> nodes;
+    typedef std::map<hd_path, typename nodes::iterator> index;
+
+    static Key derive_child(const Key& parent, uint32_t child) NOEXCEPT;
+    static hd_path prefix(const hd_path& path, size_t depth) NOEXCEPT;
+    const Key* find(const hd_path& path) NOEXCEPT;
+    const Key& store(const hd_path& path, Key&& key) NOEXCEPT;
+
+    const Key root_;
+    const size_t capacity_;
+
+    // Most recently used first.
+    nodes nodes_;
+    index index_;
+};
+
+typedef hd_cache<hd_private> hd_private_cache;
+typedef hd_cache<hd_public> hd_public_cache;
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/wallet/keys/hd_cache.ipp>
+
+#endif
@@ -102,6 +102,16 @@ public:
     hd_key to_hd_key() const NOEXCEPT;
     hd_public derive_public(uint32_t index) const NOEXCEPT;
 
+    /// Derive the points of the non-hardened children [first, first + count).
+    /// The parent point is parsed and the hmac key is scheduled once.
+    /// Empty if the range includes a hardened index or derivation fails.
+    compressed_list derive_public_range(uint32_t first,
+        uint32_t count) const NOEXCEPT;
+
+    /// Derive the hash160 of the points of derive_public_range.
+    short_hash_list derive_short_hash_range(uint32_t first,
+        uint32_t count) const NOEXCEPT;
+
 protected:
     /// Factories.
     static hd_public from_secret(const ec_secret& secret,
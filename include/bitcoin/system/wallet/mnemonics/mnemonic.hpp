@@ -22,6 +22,7 @@
 /// DELETECSTDDEF
 /// DELETECSTDINT
 #include <string>
+#include <vector>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -70,6 +71,23 @@ public:
     /// Valid word counts (12, 15, 18, 21, or 24 words).
     static bool is_valid_word_count(size_t count) NOEXCEPT;
 
+    /// Candidates are concatenated dictionary word indexes, word_count each.
+    /// Set valid to the checksum validity of each candidate, without strings.
+    /// Checksum hashes are interleaved across SIMD lanes where available.
+    /// False if word_count is invalid or any index exceeds the dictionary.
+    static bool validate(std::vector<bool>& valid,
+        const dictionary::search& candidates, size_t word_count) NOEXCEPT;
+
+    /// Derive the "master binary seed" of each candidate (as above) in the
+    /// dictionary of identifier. Checksums are not verified (see validate).
+    /// Candidates are derived across hardware threads (see parallel_for), each
+    /// pbkdf2 run is sequential (hmac-sha512 is not interleaved across lanes).
+    /// False under the conditions of validate, an invalid dictionary, or a
+    /// non-ascii passphrase with HAVE_ICU undefined.
+    static bool to_seeds(long_hash_list& out,
+        const dictionary::search& candidates, size_t word_count,
+        language identifier, const std::string& passphrase="") NOEXCEPT;
+
     mnemonic() NOEXCEPT;
     ////mnemonic(const mnemonic& other) NOEXCEPT;
 
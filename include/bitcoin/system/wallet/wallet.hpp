@@ -39,6 +39,7 @@
 #include <bitcoin/system/wallet/keys/ek_public.hpp>
 #include <bitcoin/system/wallet/keys/ek_token.hpp>
 #include <bitcoin/system/wallet/keys/encrypted_keys.hpp>
+#include <bitcoin/system/wallet/keys/hd_cache.hpp>
 #include <bitcoin/system/wallet/keys/hd_private.hpp>
 #include <bitcoin/system/wallet/keys/hd_public.hpp>
 #include <bitcoin/system/wallet/keys/mini_keys.hpp>
@@ -23,6 +23,8 @@
 /// DELETECSTDDEF
 /// DELETECSTDINT
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 /// DELETEMENOW
 #include <bitcoin/system/data/data.hpp>
@@ -35,7 +37,7 @@ namespace system {
 namespace words {
 
 // Search container for a dictionary of lexically-sorted words.
-// POD dictionary wrapper with O(n) search and O(1) index.
+// POD dictionary wrapper with O(1) search (if hashed) and O(1) index.
 // Search order is guaranteed, always returns first match.
 template<size_t Size>
 class dictionary
@@ -43,12 +45,28 @@ class dictionary
 public:
     typedef std::vector<size_t> search;
     typedef std::vector<int32_t> result;
-    typedef struct { bool sorted; std::array<const char*, Size> word; } words;
+    typedef std::conditional_t<(Size < max_uint16), uint16_t, uint32_t> slot;
     static_assert(Size <= possible_narrow_sign_cast<size_t>(max_int32));
 
+    /// Hash table slots, the power of two not less than twice Size.
+    static constexpr size_t slots = std::bit_ceil(two * Size);
+
+    /// Table slots hold word index + 1 (zero is empty), probes is the longest
+    /// probe sequence. Both are zero unless populated by hashed().
+    typedef struct
+    {
+        bool sorted;
+        std::array<const char*, Size> word;
+        size_t probes;
+        std::array<slot, slots> table;
+    } words;
+
     /// The number of words in the dictionary.
     static constexpr size_t size() NOEXCEPT { return Size; };
 
+    /// Copy of words with its hash table populated (constant initializer).
+    static constexpr words hashed(const words& words) NOEXCEPT;
+
     /// Constructor.
     dictionary(language identifier, const words& words) NOEXCEPT;
 
@@ -79,6 +97,8 @@ public:
     bool contains(const string_list& words) const NOEXCEPT;
 
 private:
+    static constexpr uint32_t hash(const std::string_view& word) NOEXCEPT;
+
     // This dictionary creates only this one word of state.
     const language identifier_;
 
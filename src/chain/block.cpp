@@ -25,9 +25,7 @@
 #include <memory>
 #include <numeric>
 #include <type_traits>
-#include <unordered_set>
 #include <utility>
-#include <unordered_map>
 /// DELETEMENOW
 /// DELETEMENOW
 #include <bitcoin/system/chain/context.hpp>
@@ -36,6 +34,7 @@
 #include <bitcoin/system/chain/enums/opcode.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
 /// DELETEMENOW
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -229,12 +228,49 @@ hash_list block::transaction_hashes(bool witness) const NOEXCEPT
     // Vector capacity is never reduced when resizing to smaller size.
     out.resize(count);
 
-    const auto hash = [witness](const transaction::cptr& tx) NOEXCEPT
+    if (is_zero(count))
+        return out;
+
+    // Transactions are serialized contiguously, so that the independent
+    // messages may be hashed together (interleaved across SIMD lanes).
+    std::vector<size_t> sizes(count);
+    std::transform(txs_->begin(), txs_->end(), sizes.begin(),
+        [witness](const transaction::cptr& tx) NOEXCEPT
+        {
+            return tx->serialized_size(witness);
+        });
+
+    data_chunk buffer(std::accumulate(sizes.begin(), sizes.end(), zero),
+        no_fill_byte_allocator);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    write::bytes::copy sink(buffer);
+    BC_POP_WARNING()
+
+    std::vector<const uint8_t*> messages(count);
+    auto message = buffer.data();
+    auto index = zero;
+    for (const auto& tx: *txs_)
     {
-        return tx->hash(witness);
-    };
+        tx->to_data(sink, witness);
+        messages[index] = message;
+        std::advance(message, sizes[index++]);
+    }
+
+    // std::vector<std::array<uint8_t, N>>.data() is size * N contiguous bytes.
+    intrinsics::double_sha256_multiple(out.front().data(), messages.data(),
+        sizes.data(), count);
+
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    index = zero;
+    for (const auto& tx: *txs_)
+    {
+        if (witness && tx->is_segregated() && tx->is_coinbase())
+            out[index] = null_hash;
+
+        ++index;
+    }
 
-    std::transform(txs_->begin(), txs_->end(), out.begin(), hash);
     return out;
 }
 
@@ -273,6 +309,29 @@ size_t block::serialized_size(bool witness) const NOEXCEPT
 ////    return hashes.size() == txs_->size();
 ////}
 
+// Txids (and point hashes) are sha256 outputs, so any eight bytes of them are
+// uniformly distributed. A per-process random odd multiplier (salt) defeats
+// precomputed bucket collisions in the open_set.
+static const auto set_salt = bit_or(hash_salt(), 1_u64);
+
+inline size_t salted(uint64_t sample) NOEXCEPT
+{
+    const auto product = sample * set_salt;
+    return possible_narrow_cast<size_t>(
+        bit_xor(product, shift_right(product, 32)));
+}
+
+size_t block::txid_hash::operator()(const hash_digest& hash) const NOEXCEPT
+{
+    return salted(from_little_endian_unchecked<uint64_t>(hash.begin()));
+}
+
+size_t block::point_hash::operator()(const point& point) const NOEXCEPT
+{
+    return salted(from_little_endian_unchecked<uint64_t>(point.hash().begin())
+        + point.index());
+}
+
 bool block::is_empty() const NOEXCEPT
 {
     return txs_->empty();
@@ -309,20 +368,16 @@ bool block::is_extra_coinbases() const NOEXCEPT
 //*****************************************************************************
 bool block::is_forward_reference() const NOEXCEPT
 {
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    std::unordered_map<hash_digest, bool> hashes(txs_->size());
-    BC_POP_WARNING()
+    open_set<hash_digest, txid_hash> hashes(txs_->size());
 
     const auto is_forward = [&hashes](const input::cptr& input) NOEXCEPT
     {
-        return !is_zero(hashes.count(input->point().hash()));
+        return hashes.contains(input->point().hash());
     };
 
     for (const auto& tx: views_reverse(*txs_))
     {
-        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-        hashes.emplace(tx->hash(false), false);
-        BC_POP_WARNING()
+        hashes.insert(tx->hash(false));
 
         const auto& inputs = *tx->inputs_ptr();
         if (std::any_of(inputs.begin(), inputs.end(), is_forward))
@@ -349,17 +404,23 @@ bool block::is_internal_double_spend() const NOEXCEPT
     if (txs_->empty())
         return false;
 
-    // A set is used to collapse duplicate points.
-    std::unordered_set<point> outs{};
+    // A set is used to detect duplicate points (no per-point allocation).
+    open_set<point, point_hash> outs(non_coinbase_inputs());
+
+    const auto is_duplicate = [&outs](const input::cptr& input) NOEXCEPT
+    {
+        return !outs.insert(input->point());
+    };
 
-    // Move the points of all non-coinbase transactions into one set.
+    // Insert the points of all non-coinbase transactions into one set.
     for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
     {
-        auto out =(*tx)->points();
-        std::move(out.begin(), out.end(), std::inserter(outs, outs.end()));
+        const auto& inputs = *(*tx)->inputs_ptr();
+        if (std::any_of(inputs.begin(), inputs.end(), is_duplicate))
+            return true;
     }
 
-    return outs.size() != non_coinbase_inputs();
+    return false;
 }
 
 // private
@@ -424,29 +485,22 @@ bool block::is_hash_limit_exceeded() const NOEXCEPT
         return false;
 
     // A set is used to collapse duplicates.
-    std::unordered_set<hash_digest> hashes;
+    open_set<hash_digest, txid_hash> hashes(ceilinged_add(txs_->size(),
+        non_coinbase_inputs()));
 
     // Just the coinbase tx hash, skip its null input hashes.
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
     hashes.insert(txs_->front()->hash(false));
-    BC_POP_WARNING()
 
     for (auto tx = std::next(txs_->begin()); tx != txs_->end(); ++tx)
     {
         // Insert the transaction hash.
-        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
         hashes.insert((*tx)->hash(false));
-        BC_POP_WARNING()
 
         const auto& inputs = *(*tx)->inputs_ptr();
 
         // Insert all input point hashes.
         for (const auto& input: inputs)
-        {
-            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
             hashes.insert(input->point().hash());
-            BC_POP_WARNING()
-        }
     }
 
     return hashes.size() > hash_limit;
@@ -536,6 +590,28 @@ bool block::is_overspent(size_t height, uint64_t subsidy_interval,
         initial_block_subsidy_satoshi, bip42);
 }
 
+bool block::is_overspent(size_t height, uint64_t subsidy_interval,
+    uint64_t initial_block_subsidy_satoshi, bool bip42,
+    const prevout_table& prevouts) const NOEXCEPT
+{
+    // Mirrors fees(), including the (default) coinbase prevout value.
+    auto first = zero;
+    auto fees = 0_u64;
+    for (const auto& tx: *txs_)
+    {
+        const auto count = tx->inputs_ptr()->size();
+        const auto fee = floored_subtract(prevouts.value(first, count),
+            tx->claim());
+
+        // Overflow returns max_uint64.
+        fees = ceilinged_add(fees, fee);
+        first += count;
+    }
+
+    return claim() > ceilinged_add(fees, block_subsidy(height,
+        subsidy_interval, initial_block_subsidy_satoshi, bip42));
+}
+
 bool block::is_signature_operations_limited(bool bip16,
     bool bip141) const NOEXCEPT
 {
@@ -569,6 +645,20 @@ bool block::is_unspent_coinbase_collision(size_t height) const NOEXCEPT
     return !(height > prevout->height && prevout->spent);
 }
 
+bool block::is_unspent_coinbase_collision(size_t height,
+    const prevout_table& prevouts) const NOEXCEPT
+{
+    if (txs_->empty() || txs_->front()->inputs_ptr()->empty())
+        return false;
+
+    // The coinbase input is always the first record of the table.
+    const auto record = prevouts.at(zero);
+    const auto spent = !is_zero(bit_and<uint8_t>(record.flags,
+        prevout_record::spent));
+
+    return !(height > record.height && spent);
+}
+
 // Delegated.
 // ----------------------------------------------------------------------------
 
@@ -594,6 +684,47 @@ code block::accept_transactions(const context& state) const NOEXCEPT
     return error::block_success;
 }
 
+code block::accept_transactions(const context& state,
+    const prevout_table& prevouts, bool parallel) const NOEXCEPT
+{
+    // Offset of each tx into the table (block input order).
+    std::vector<size_t> firsts(txs_->size());
+    auto first = zero;
+    auto index = zero;
+    for (const auto& tx: *txs_)
+    {
+        firsts[index++] = first;
+        first += tx->inputs_ptr()->size();
+    }
+
+    if (first > prevouts.size())
+        return error::missing_previous_output;
+
+    if (parallel)
+    {
+        // Each tx is independent, so the first error (in block order) is the
+        // first non-success code in the result set.
+        std::vector<code> codes(txs_->size());
+        parallel_for(txs_->size(), [&](size_t tx) NOEXCEPT
+        {
+            codes[tx] = (*txs_)[tx]->accept(state, prevouts, firsts[tx]);
+        });
+
+        const auto it = std::find_if(codes.begin(), codes.end(),
+            [](const code& ec) NOEXCEPT { return !!ec; });
+
+        return it == codes.end() ? error::block_success : *it;
+    }
+
+    code ec;
+    index = zero;
+    for (const auto& tx: *txs_)
+        if ((ec = tx->accept(state, prevouts, firsts[index++])))
+            return ec;
+
+    return error::block_success;
+}
+
 code block::connect_transactions(const context& state) const NOEXCEPT
 {
     code ec;
@@ -700,6 +831,56 @@ code block::accept(const context& state, size_t subsidy_interval,
     return accept_transactions(state);
 }
 
+// As accept(state, subsidy_interval, initial_subsidy), with prevout metadata
+// read from the table (sigop counting still reads input.prevout scripts).
+code block::accept(const context& state, size_t subsidy_interval,
+    uint64_t initial_subsidy, const prevout_table& prevouts,
+    bool parallel) const NOEXCEPT
+{
+    const auto bip16 = state.is_enabled(bip16_rule);
+    const auto bip30 = state.is_enabled(bip30_rule);
+    const auto bip34 = state.is_enabled(bip34_rule);
+    const auto bip42 = state.is_enabled(bip42_rule);
+    const auto bip50 = state.is_enabled(bip50_rule);
+    const auto bip141 = state.is_enabled(bip141_rule);
+
+    if (bip141 && is_overweight())
+        return error::block_weight_limit;
+
+    if (bip34 && is_invalid_coinbase_script(state.height))
+        return error::coinbase_height_mismatch;
+
+    if (bip50 && is_hash_limit_exceeded())
+        return error::temporary_hash_limit;
+
+    if (bip141 && is_invalid_witness_commitment())
+        return error::invalid_witness_commitment;
+
+    // prevouts required
+
+    // Each input must have a record (table is otherwise not block-aligned).
+    const auto inputs = txs_->empty() ? zero : ceilinged_add(
+        txs_->front()->inputs_ptr()->size(), non_coinbase_inputs());
+
+    if (prevouts.size() < inputs)
+        return error::missing_previous_output;
+
+    if (is_overspent(state.height, subsidy_interval, initial_subsidy, bip42,
+        prevouts))
+        return error::coinbase_value_limit;
+
+    if (is_signature_operations_limited(bip16, bip141))
+        return error::block_sigop_limit;
+
+    // prevout confirmation state required
+
+    if (bip30 && !bip34 && is_unspent_coinbase_collision(state.height,
+        prevouts))
+        return error::unspent_coinbase_collision;
+
+    return accept_transactions(state, prevouts, parallel);
+}
+
 code block::connect(const context& state) const NOEXCEPT
 {
     return connect_transactions(state);
@@ -232,6 +232,21 @@ hash_digest header::hash() const NOEXCEPT
     return sha256_hash(sha256);
 }
 
+// Mining.
+// ----------------------------------------------------------------------------
+
+bool header::find_nonce(uint32_t& nonce, uint32_t first,
+    uint32_t count) const NOEXCEPT
+{
+    const auto target = compact::expand(bits_);
+    if (is_zero(target))
+        return false;
+
+    const auto data = to_data();
+    return intrinsics::sha256_nonce_scan(nonce, data.data(), first, count,
+        from_uintx(target).data());
+}
+
 // static/private
 uint256_t header::difficulty(uint32_t bits) NOEXCEPT
 {
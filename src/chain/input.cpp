@@ -29,6 +29,7 @@
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/chain/witness.hpp>
 /// DELETEMENOW
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/stream/stream.hpp>
@@ -172,12 +173,8 @@ input input::from_data(reader& source) NOEXCEPT
     // Witness is deserialized by transaction.
     return
     {
-        BC_PUSH_WARNING(NO_NEW_DELETE)
-        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-        to_shared(new chain::point{ source }),
-        to_shared(new chain::script{ source, true }),
-        BC_POP_WARNING()
-        BC_POP_WARNING()
+        to_pooled<chain::point>(source),
+        to_pooled<chain::script>(source, true),
 
         to_shared<chain::witness>(),
         source.read_4_bytes_little_endian(),
@@ -278,28 +275,37 @@ bool input::is_final() const NOEXCEPT
     return sequence_ == max_input_sequence;
 }
 
-bool input::is_locked(size_t height, uint32_t median_time_past) const NOEXCEPT
+// static
+bool input::is_locked(uint32_t sequence, size_t height,
+    uint32_t median_time_past, size_t prevout_height,
+    uint32_t prevout_median_time_past) NOEXCEPT
 {
     // BIP68: if bit 31 is set then no consensus meaning is applied.
-    if (get_right(sequence_, relative_locktime_disabled_bit))
+    if (get_right(sequence, relative_locktime_disabled_bit))
         return false;
 
     // BIP68: the low 16 bits of the sequence apply to relative lock-time.
-    const auto blocks = mask_left(sequence_, relative_locktime_mask_left);
+    const auto blocks = mask_left(sequence, relative_locktime_mask_left);
 
     // BIP68: bit 22 determines if relative lock is time or block based.
-    if (get_right(sequence_, relative_locktime_time_locked_bit))
+    if (get_right(sequence, relative_locktime_time_locked_bit))
     {
         // BIP68: change sequence to seconds by shifting up by 9 bits (x 512).
         auto time = shift_left(blocks, relative_locktime_seconds_shift_left);
-        auto age = floored_subtract(median_time_past, prevout->median_time_past);
+        auto age = floored_subtract(median_time_past, prevout_median_time_past);
         return age < time;
     }
 
-    auto age = floored_subtract(height, prevout->height);
+    auto age = floored_subtract(height, prevout_height);
     return age < blocks;
 }
 
+bool input::is_locked(size_t height, uint32_t median_time_past) const NOEXCEPT
+{
+    return is_locked(sequence_, height, median_time_past, prevout->height,
+        prevout->median_time_past);
+}
+
 bool input::reserved_hash(hash_digest& out) const NOEXCEPT
 {
     if (!witness::is_reserved_pattern(witness_->stack()))
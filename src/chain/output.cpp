@@ -25,6 +25,7 @@
 #include <memory>
 #include <bitcoin/system/chain/enums/magic_numbers.hpp>
 /// DELETEMENOW
+#include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/stream/stream.hpp>
@@ -119,11 +120,7 @@ output output::from_data(reader& source) NOEXCEPT
     {
         source.read_8_bytes_little_endian(),
 
-        BC_PUSH_WARNING(NO_NEW_DELETE)
-        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-        to_shared(new chain::script{ source, true }),
-        BC_POP_WARNING()
-        BC_POP_WARNING()
+        to_pooled<chain::script>(source, true),
 
         source
     };
@@ -0,0 +1,335 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/prevout_table.hpp>
+
+#include <iterator>
+#include <numeric>
+#include <vector>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/input.hpp>
+#include <bitcoin/system/chain/prevout.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/error/error.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Range checks are written as branchless reductions over the columns, so that
+// each is a single tight loop over contiguous memory.
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+prevout_table::prevout_table() NOEXCEPT
+{
+}
+
+prevout_table::prevout_table(size_t count) NOEXCEPT
+{
+    reserve(count);
+}
+
+prevout_table::prevout_table(const transaction_ptrs& txs) NOEXCEPT
+{
+    // Overflow returns max_size_t.
+    const auto inputs = [](size_t total, const transaction::cptr& tx) NOEXCEPT
+    {
+        return ceilinged_add(total, tx->inputs_ptr()->size());
+    };
+
+    reserve(std::accumulate(txs.begin(), txs.end(), zero, inputs));
+
+    for (const auto& tx: txs)
+        for (const auto& input: *tx->inputs_ptr())
+            push_back(*input->prevout);
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool prevout_table::empty() const NOEXCEPT
+{
+    return flags_.empty();
+}
+
+size_t prevout_table::size() const NOEXCEPT
+{
+    return flags_.size();
+}
+
+prevout_record prevout_table::at(size_t index) const NOEXCEPT
+{
+    BC_ASSERT(index < size());
+
+    return
+    {
+        values_[index],
+        heights_[index],
+        median_times_past_[index],
+        script_offsets_[index],
+        flags_[index]
+    };
+}
+
+const std::vector<uint64_t>& prevout_table::values() const NOEXCEPT
+{
+    return values_;
+}
+
+const std::vector<uint32_t>& prevout_table::heights() const NOEXCEPT
+{
+    return heights_;
+}
+
+const std::vector<uint32_t>& prevout_table::median_times_past() const NOEXCEPT
+{
+    return median_times_past_;
+}
+
+const std::vector<uint32_t>& prevout_table::script_offsets() const NOEXCEPT
+{
+    return script_offsets_;
+}
+
+const std::vector<uint8_t>& prevout_table::flags() const NOEXCEPT
+{
+    return flags_;
+}
+
+// Population.
+// ----------------------------------------------------------------------------
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+void prevout_table::reserve(size_t count) NOEXCEPT
+{
+    values_.reserve(count);
+    heights_.reserve(count);
+    median_times_past_.reserve(count);
+    script_offsets_.reserve(count);
+    flags_.reserve(count);
+}
+
+void prevout_table::push_back(const prevout_record& record) NOEXCEPT
+{
+    values_.push_back(record.value);
+    heights_.push_back(record.height);
+    median_times_past_.push_back(record.median_time_past);
+    script_offsets_.push_back(record.script_offset);
+    flags_.push_back(record.flags);
+}
+
+BC_POP_WARNING()
+
+void prevout_table::push_back(const chain::prevout& prevout) NOEXCEPT
+{
+    const auto flags = bit_or(
+        bit_or(prevout.is_valid() ? prevout_record::found : uint8_t{ 0 },
+            prevout.spent ? prevout_record::spent : uint8_t{ 0 }),
+            prevout.coinbase ? prevout_record::coinbase : uint8_t{ 0 });
+
+    // Heights are bounded by chain length (and median time past by type).
+    push_back(
+    {
+        prevout.value(),
+        possible_narrow_cast<uint32_t>(prevout.height),
+        prevout.median_time_past,
+        0,
+        flags
+    });
+}
+
+void prevout_table::clear() NOEXCEPT
+{
+    values_.clear();
+    heights_.clear();
+    median_times_past_.clear();
+    script_offsets_.clear();
+    flags_.clear();
+}
+
+// Range checks.
+// ----------------------------------------------------------------------------
+
+// Zero is either genesis or not found, either is immature.
+// uint32_t height cannot overflow when widened to uint64_t.
+//*****************************************************************************
+// CONSENSUS: Genesis block is treated as forever immature (satoshi bug).
+//*****************************************************************************
+static inline bool immature(uint8_t flags, uint64_t prevout_height,
+    size_t height) NOEXCEPT
+{
+    return !is_zero(bit_and(flags, prevout_record::coinbase)) &&
+        (is_zero(prevout_height) || height < prevout_height + coinbase_maturity);
+}
+
+// Zero is either genesis or not found.
+static inline bool unconfirmed(uint32_t prevout_height, size_t height) NOEXCEPT
+{
+    return is_zero(prevout_height) && !(height > prevout_height);
+}
+
+static inline bool double_spent(uint8_t flags, uint32_t prevout_height,
+    size_t height) NOEXCEPT
+{
+    return !is_zero(bit_and(flags, prevout_record::spent)) &&
+        height > prevout_height;
+}
+
+bool prevout_table::is_missing(size_t first, size_t count) const NOEXCEPT
+{
+    BC_ASSERT(first + count <= size());
+
+    uint8_t found = prevout_record::found;
+    for (auto index = first; index < first + count; ++index)
+        found &= flags_[index];
+
+    return is_zero(found);
+}
+
+uint64_t prevout_table::value(size_t first, size_t count) const NOEXCEPT
+{
+    BC_ASSERT(first + count <= size());
+
+    // Overflow returns max_uint64.
+    auto total = 0_u64;
+    for (auto index = first; index < first + count; ++index)
+        total = ceilinged_add(total, values_[index]);
+
+    return total;
+}
+
+bool prevout_table::is_immature(size_t first, size_t count,
+    size_t height) const NOEXCEPT
+{
+    BC_ASSERT(first + count <= size());
+
+    auto result = false;
+    for (auto index = first; index < first + count; ++index)
+        result |= immature(flags_[index], heights_[index], height);
+
+    return result;
+}
+
+bool prevout_table::is_locked(size_t first, const input_cptrs& inputs,
+    size_t height, uint32_t median_time_past) const NOEXCEPT
+{
+    BC_ASSERT(first + inputs.size() <= size());
+
+    auto result = false;
+    auto index = first;
+    for (const auto& input: inputs)
+    {
+        result |= input::is_locked(input->sequence(), height,
+            median_time_past, heights_[index], median_times_past_[index]);
+        ++index;
+    }
+
+    return result;
+}
+
+bool prevout_table::is_unconfirmed_spend(size_t first, size_t count,
+    size_t height) const NOEXCEPT
+{
+    BC_ASSERT(first + count <= size());
+
+    auto result = false;
+    for (auto index = first; index < first + count; ++index)
+        result |= unconfirmed(heights_[index], height);
+
+    return result;
+}
+
+bool prevout_table::is_confirmed_double_spend(size_t first, size_t count,
+    size_t height) const NOEXCEPT
+{
+    BC_ASSERT(first + count <= size());
+
+    auto result = false;
+    for (auto index = first; index < first + count; ++index)
+        result |= double_spent(flags_[index], heights_[index], height);
+
+    return result;
+}
+
+// Fused check.
+// ----------------------------------------------------------------------------
+
+// All conditions are accumulated in one sweep over the records (and input
+// sequences), then reported in the order of the individual transaction checks,
+// so the result is identical to that of the sequence of range checks above.
+code prevout_table::accept(size_t first, const input_cptrs& inputs,
+    uint64_t claim, size_t height, uint32_t median_time_past,
+    bool relative_locks) const NOEXCEPT
+{
+    BC_ASSERT(first + inputs.size() <= size());
+
+    uint8_t found = prevout_record::found;
+    auto total = 0_u64;
+    auto is_immature = false;
+    auto is_locked = false;
+    auto is_unconfirmed = false;
+    auto is_spent = false;
+    auto index = first;
+
+    for (const auto& input: inputs)
+    {
+        const auto flags = flags_[index];
+        const auto prevout_height = heights_[index];
+
+        found &= flags;
+        total = ceilinged_add(total, values_[index]);
+        is_immature |= immature(flags, prevout_height, height);
+        is_unconfirmed |= unconfirmed(prevout_height, height);
+        is_spent |= double_spent(flags, prevout_height, height);
+
+        if (relative_locks)
+            is_locked |= input::is_locked(input->sequence(), height,
+                median_time_past, prevout_height, median_times_past_[index]);
+
+        ++index;
+    }
+
+    if (is_zero(found))
+        return error::missing_previous_output;
+
+    if (claim > total)
+        return error::spend_exceeds_value;
+
+    if (is_immature)
+        return error::coinbase_maturity;
+
+    if (is_locked)
+        return error::relative_time_locked;
+
+    if (is_unconfirmed)
+        return error::unconfirmed_spend;
+
+    if (is_spent)
+        return error::confirmed_double_spend;
+
+    return error::transaction_success;
+}
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
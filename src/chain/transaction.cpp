@@ -33,6 +33,7 @@
 #include <bitcoin/system/chain/header.hpp>
 #include <bitcoin/system/chain/input.hpp>
 #include <bitcoin/system/chain/output.hpp>
+#include <bitcoin/system/chain/prevout_table.hpp>
 #include <bitcoin/system/chain/script.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 /// DELETEMENOW
@@ -215,12 +216,11 @@ read_puts(Source& source) NOEXCEPT
     puts->reserve(source.read_size(max_block_size));
     BC_POP_WARNING()
 
+    // Instance and control block are a single (pooled) allocation.
     for (auto put = zero; put < puts->capacity(); ++put)
     {
-        BC_PUSH_WARNING(NO_NEW_DELETE)
         BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-        puts->emplace_back(new Put{ source });
-        BC_POP_WARNING()
+        puts->push_back(to_pooled<std::remove_const_t<Put>>(source));
         BC_POP_WARNING()
     }
 
@@ -262,12 +262,8 @@ transaction transaction::from_data(reader& source, bool witness) NOEXCEPT
                 // input::witness_ a mutable public property of the instance.
                 const auto setter = const_cast<chain::input*>(input.get());
 
-                // Use of pointer forward here avoids move construction.
-                BC_PUSH_WARNING(NO_NEW_DELETE)
-                BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-                setter->witness_ = to_shared(new chain::witness{ source, true });
-                BC_POP_WARNING()
-                BC_POP_WARNING()
+                // In-place construction here avoids move construction.
+                setter->witness_ = to_pooled<chain::witness>(source, true);
             }
             else
             {
@@ -736,11 +732,11 @@ hash_digest transaction::unversioned_signature_hash(
 
 // private
 // TODO: taproot requires both single and double hash of each.
-void transaction::initialize_hash_cache() const NOEXCEPT
+void transaction::initialize_hash_cache(bool witness) const NOEXCEPT
 {
     // This overconstructs the cache (anyone or !all), however it is simple and
     // the same criteria applied by satoshi.
-    if (segregated_)
+    if (witness)
     {
         BC_PUSH_WARNING(NO_NEW_DELETE)
         BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
@@ -905,6 +901,66 @@ bool transaction::create_endorsement(endorsement& out, const ec_secret& secret,
     return true;
 }
 
+// This is not used internal to the library.
+bool transaction::create_endorsements(endorsements& out,
+    const signers& signers, bool bip143, bool deterministic) const NOEXCEPT
+{
+    out.resize(signers.size());
+    if (signers.empty())
+        return true;
+
+    const auto witness = [](const signer& item) NOEXCEPT
+    {
+        return item.version == script_version::zero;
+    };
+
+    // Cache witness hash components that don't change per input. The cache is
+    // populated before signing so that workers only read it. An unsigned tx is
+    // not yet segregated, so this is conditioned on the signers.
+    if (bip143 && !cache_)
+        initialize_hash_cache(std::any_of(signers.begin(), signers.end(),
+            witness));
+
+    const auto endorse = [&](const signer& item) NOEXCEPT
+    {
+        if (item.index >= inputs_->size() || !item.sub)
+            return false;
+
+        const auto sighash = signature_hash(input_at(item.index), *item.sub,
+            item.value, item.flags, item.version, bip143);
+
+        BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+        ec_signature signature;
+        hash_digest entropy;
+        BC_POP_WARNING()
+
+        // Hedge entropy is drawn from the device, the twister is predictable.
+        if (!deterministic && !pseudo_random::entropy(entropy))
+            return false;
+
+        if (deterministic ? !sign(signature, item.secret, sighash) :
+            !sign(signature, item.secret, sighash, entropy))
+            return false;
+
+        // Endorsements are indexed by signer, storage is not shrunk.
+        auto& endorsement = out[possible_narrow_and_sign_cast<size_t>(
+            std::distance(signers.data(), &item))];
+        endorsement.clear();
+        endorsement.reserve(max_endorsement_size);
+        if (!encode_signature(endorsement, signature))
+            return false;
+
+        // Add the sighash type to the end of the DER signature -> endorsement.
+        endorsement.push_back(item.flags);
+        return true;
+    };
+
+    return parallel_all_of(signers.size(), [&](size_t index) NOEXCEPT
+    {
+        return endorse(signers[index]);
+    });
+}
+
 // Guard (context free).
 // ----------------------------------------------------------------------------
 
@@ -1252,6 +1308,31 @@ code transaction::accept(const context& state) const NOEXCEPT
     return error::transaction_success;
 }
 
+// Prevout metadata is read from the table range beginning at first, in place
+// of input.prevout, in a single sweep over the inputs. Otherwise identical to
+// accept(state), including the order of error precedence.
+code transaction::accept(const context& state, const prevout_table& prevouts,
+    size_t first) const NOEXCEPT
+{
+    const auto bip68 = state.is_enabled(forks::bip68_rule);
+    const auto bip113 = state.is_enabled(forks::bip113_rule);
+
+    // Store note: timestamp and mtp should be merged to single field.
+    if (is_non_final(state.height, state.timestamp, state.median_time_past, bip113))
+        return error::transaction_non_final;
+
+    // Coinbases do not have prevouts.
+    if (is_coinbase())
+        return error::transaction_success;
+
+    // BIP68: applied to txs with a version greater than or equal to two.
+    const auto relative_locks = bip68 &&
+        version_ >= relative_locktime_min_version;
+
+    return prevouts.accept(first, *inputs_, claim(), state.height,
+        state.median_time_past, relative_locks);
+}
+
 // Connect (contextual).
 // ------------------------------------------------------------------------
 
@@ -1260,7 +1341,7 @@ code transaction::connect(const context& state) const NOEXCEPT
     code ec;
 
     // Cache witness hash components that don't change per input.
-    initialize_hash_cache();
+    initialize_hash_cache(segregated_);
     
     const auto is_roller = [](const auto& input) NOEXCEPT
     {
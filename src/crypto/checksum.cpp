@@ -18,6 +18,9 @@
  */
 #include <bitcoin/system/crypto/checksum.hpp>
 
+#include <array>
+#include <iterator>
+#include <string>
 #include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -95,28 +98,58 @@ static base32_chunk bech32_expand_checksum(uint32_t checksum) NOEXCEPT
     return out;
 }
 
-static uint32_t bech32_checksum(const base32_chunk& data) NOEXCEPT
+// Generator terms of the five coefficient bits, combined for each coefficient.
+static constexpr std::array<uint32_t, 32> bech32_generators() NOEXCEPT
+{
+    constexpr uint32_t generator[] =
+    {
+        0x3b6a57b2, 0x26508e6d, 0x1ea119fa, 0x3d4233dd, 0x2a1462b3
+    };
+
+    std::array<uint32_t, 32> table{};
+    for (size_t coefficient = 0; coefficient < table.size(); ++coefficient)
+        for (size_t bit = 0; bit < std::size(generator); ++bit)
+            if (get_right(coefficient, bit))
+                table[coefficient] ^= generator[bit];
+
+    return table;
+}
+
+static constexpr auto bech32_table = bech32_generators();
+
+uint32_t bech32_polymod(uint32_t checksum, uint8_t value) NOEXCEPT
+{
+    const auto coefficient = checksum >> 25;
+    return ((checksum & 0x01ffffff) << 5) ^ value ^ bech32_table[coefficient];
+}
+
+uint32_t bech32_prefix_polymod(const std::string& prefix) NOEXCEPT
 {
+    const auto lower = ascii_to_lower(prefix);
+
     uint32_t checksum = 1;
+    for (const auto character: lower)
+        checksum = bech32_polymod(checksum, (character >> 5) & 0x1f);
+
+    checksum = bech32_polymod(checksum, 0x00);
+    for (const auto character: lower)
+        checksum = bech32_polymod(checksum, character & 0x1f);
+
+    return checksum;
+}
 
+static uint32_t bech32_checksum(const base32_chunk& data) NOEXCEPT
+{
+    uint32_t checksum = 1;
     for (const auto& value: data)
-    {
-        const uint32_t coeficient = (checksum >> 25);
-        checksum = ((checksum & 0x01ffffff) << 5) ^ value.convert_to<uint8_t>();
-
-        if (coeficient & 0x01) checksum ^= 0x3b6a57b2;
-        if (coeficient & 0x02) checksum ^= 0x26508e6d;
-        if (coeficient & 0x04) checksum ^= 0x1ea119fa;
-        if (coeficient & 0x08) checksum ^= 0x3d4233dd;
-        if (coeficient & 0x10) checksum ^= 0x2a1462b3;
-    }
+        checksum = bech32_polymod(checksum, value.convert_to<uint8_t>());
 
     return checksum;
 }
 
 // BIP173: All versions use 0x00000001 (bech32).
 // BIP350: Nonzero versions use 0x2bc830a3 (bech32m).
-static uint32_t bech32_constant(uint8_t version) NOEXCEPT
+uint32_t bech32_constant(uint8_t version) NOEXCEPT
 {
     return is_zero(version) ? 0x00000001 : 0x2bc830a3;
 }
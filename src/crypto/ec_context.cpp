@@ -18,7 +18,10 @@
  */
 #include "ec_context.hpp"
 
+#include <boost/thread/tss.hpp>
 #include <secp256k1.h>
+#include <bitcoin/system/crypto/hash.hpp>
+#include <bitcoin/system/crypto/pseudo_random.hpp>
 #include <bitcoin/system/define.hpp>
 
 namespace libbitcoin {
@@ -31,6 +34,13 @@ ec_context::ec_context(int flags) NOEXCEPT
     BC_ASSERT(context_ != nullptr);
 }
 
+// Protected base class copy (tables are copied, not rebuilt).
+ec_context::ec_context(const secp256k1_context* prototype) NOEXCEPT
+  : context_(secp256k1_context_clone(prototype))
+{
+    BC_ASSERT(context_ != nullptr);
+}
+
 // Clean up the context on destruct.
 ec_context::~ec_context() NOEXCEPT
 {
@@ -42,15 +52,82 @@ ec_context::~ec_context() NOEXCEPT
 
 // Concrete type for signing init.
 ec_context_sign::ec_context_sign() NOEXCEPT
-  : ec_context(SECP256K1_CONTEXT_SIGN)
+  : ec_context(SECP256K1_CONTEXT_SIGN), uses_(zero),
+    source_(&pseudo_random::entropy)
+{
+}
+
+// Concrete type for signing thread init.
+ec_context_sign::ec_context_sign(const ec_context_sign& prototype) NOEXCEPT
+  : ec_context(prototype.context_), uses_(zero),
+    source_(&pseudo_random::entropy)
 {
 }
 
 const secp256k1_context* ec_context_sign::context() NOEXCEPT
 {
-    static ec_context_sign instance;
-    static auto context = instance.context_;
-    return context;
+    auto& self = instance();
+
+    // Blinding is refreshed periodically (it does not affect results).
+    if (++self.uses_ >= rerandomize_interval)
+        self.blind();
+
+    return self.context_;
+}
+
+bool ec_context_sign::randomize() NOEXCEPT
+{
+    return instance().blind();
+}
+
+bool ec_context_sign::randomize(ec_entropy source) NOEXCEPT
+{
+    auto& self = instance();
+    self.source_ = source;
+    return self.blind();
+}
+
+void ec_context_sign::release() NOEXCEPT
+{
+    instances().reset();
+}
+
+ec_context_sign& ec_context_sign::instance() NOEXCEPT
+{
+    // The prototype is never blinded or used, only cloned.
+    static const ec_context_sign prototype{};
+    auto& thread = instances();
+
+    // This is thread safe because the instance is thread static.
+    if (is_null(thread.get()))
+    {
+        thread.reset(new ec_context_sign(prototype));
+        thread->blind();
+    }
+
+    return *thread;
+}
+
+boost::thread_specific_ptr<ec_context_sign>&
+ec_context_sign::instances() NOEXCEPT
+{
+    // Maintain thread static state space, deleted on thread termination.
+    // This throws given insufficient resources.
+    static boost::thread_specific_ptr<ec_context_sign> instances{};
+    return instances;
+}
+
+bool ec_context_sign::blind() NOEXCEPT
+{
+    // Blinding protects against side channels, so the seed must not be
+    // predictable. The context is left unchanged if the source fails, and
+    // the attempt is not repeated until the next interval.
+    uses_ = zero;
+    hash_digest seed;
+    if (!source_(seed))
+        return false;
+
+    return secp256k1_context_randomize(context_, seed.data()) == 1;
 }
 
 // Concrete type for verification init.
@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_SYSTEM_CRYPTO_EC_CONTEXT_HPP
 #define LIBBITCOIN_SYSTEM_CRYPTO_EC_CONTEXT_HPP
 
+#include <boost/thread/tss.hpp>
 #include <secp256k1.h>
+#include <bitcoin/system/crypto/elliptic_curve.hpp>
 #include <bitcoin/system/define.hpp>
 
 namespace libbitcoin {
@@ -40,23 +42,51 @@ public:
 
 protected:
     ec_context(int flags) NOEXCEPT;
+    ec_context(const secp256k1_context* prototype) NOEXCEPT;
 
     // This unpublished header hides this external symbol.
     secp256k1_context* context_;
 };
 
-/// A signing context singleton initializer.
+/// A signing context per thread, cloned from a shared prototype (so tables
+/// are not rebuilt) and blinded with its own randomness. Blinding is refreshed
+/// after each rerandomize_interval uses (or attempted refreshes). The thread's context is destroyed on
+/// thread exit or release(), and is recreated on next use.
 class BC_API ec_context_sign
   : public ec_context
 {
 public:
+    static constexpr size_t rerandomize_interval = 1024;
+
+    /// The calling thread's context.
     static const secp256k1_context* context() NOEXCEPT;
 
+    /// Refresh the blinding of the calling thread's context.
+    static bool randomize() NOEXCEPT;
+
+    /// Set the blinding seed source of the calling thread's context (until
+    /// released) and refresh its blinding.
+    static bool randomize(ec_entropy source) NOEXCEPT;
+
+    /// Destroy the calling thread's context.
+    static void release() NOEXCEPT;
+
 protected:
     ec_context_sign() NOEXCEPT;
+    ec_context_sign(const ec_context_sign& prototype) NOEXCEPT;
+
+private:
+    static ec_context_sign& instance() NOEXCEPT;
+    static boost::thread_specific_ptr<ec_context_sign>& instances() NOEXCEPT;
+    bool blind() NOEXCEPT;
+
+    size_t uses_;
+    ec_entropy source_;
 };
 
 /// A verification context singleton initializer.
+/// Verification tables are read-only once built, so a shared context has no
+/// contention, and per-thread copies would cost their size for each thread.
 class BC_API ec_context_verify
   : public ec_context
 {
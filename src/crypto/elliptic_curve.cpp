@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 #include <secp256k1.h>
 #include <secp256k1_recovery.h>
 #include <bitcoin/system/crypto/external/external.hpp>
@@ -36,6 +37,7 @@ static constexpr auto maximum_recovery_id = 3;
 static constexpr auto compressed_even = 0x02_u8;
 static constexpr auto compressed_odd = 0x03_u8;
 static constexpr auto uncompressed = 0x04_u8;
+static constexpr size_t secret_to_public_chunk = 1024;
 
 constexpr int to_flags(bool compressed) NOEXCEPT
 {
@@ -204,6 +206,30 @@ bool ec_add(ec_compressed& left, const ec_uncompressed& right) NOEXCEPT
     return compress(out, right) && ec_add(left, out);
 }
 
+// parse once, (copy, add, serialize) for each scalar
+bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT
+{
+    auto const* context = ec_context_verify::context();
+
+    secp256k1_pubkey parent;
+    if (!parse(context, parent, point))
+        return false;
+
+    out.resize(scalars.size());
+    auto sum = out.begin();
+
+    for (const auto& scalar: scalars)
+    {
+        auto pubkey = parent;
+        if (secp256k1_ec_pubkey_tweak_add(context, &pubkey, scalar.data()) !=
+            ec_success || !serialize(context, *sum++, pubkey))
+            return false;
+    }
+
+    return true;
+}
+
 // parse, combine, serialize
 bool ec_sum(ec_compressed& out, const compressed_list& points) NOEXCEPT
 {
@@ -296,6 +322,86 @@ bool secret_to_public(ec_uncompressed& out, const ec_secret& secret) NOEXCEPT
     return secret_to_public(context, out, secret);
 }
 
+// Invoke chunk(first, count) over count items, in parallel.
+template <typename Chunk>
+static bool for_each_chunk(size_t count, const Chunk& chunk) NOEXCEPT
+{
+    return parallel_all_of(ceilinged_divide(count, secret_to_public_chunk),
+        [&](size_t index) NOEXCEPT
+        {
+            const auto first = index * secret_to_public_chunk;
+            return chunk(first, std::min(secret_to_public_chunk,
+                count - first));
+        });
+}
+
+bool secret_to_public(compressed_list& out,
+    const secret_list& secrets) NOEXCEPT
+{
+    out.resize(secrets.size());
+
+    return for_each_chunk(secrets.size(), [&](size_t first, size_t count)
+        NOEXCEPT
+        {
+            // Each worker thread signs with its own context.
+            auto const* context = ec_context_sign::context();
+            for (auto index = first; index < first + count; ++index)
+                if (!secret_to_public(context, out[index], secrets[index]))
+                    return false;
+
+            return true;
+        });
+}
+
+// create (once per chunk), combine with generator, serialize
+bool secret_to_public_range(compressed_list& out, const ec_secret& first,
+    size_t count) NOEXCEPT
+{
+    auto const* verify = ec_context_verify::context();
+
+    secp256k1_pubkey generator;
+    if (!parse(verify, generator, ec_compressed_generator))
+        return false;
+
+    out.resize(count);
+    return for_each_chunk(count, [&](size_t start, size_t size) NOEXCEPT
+        {
+            // The chunk secret is first + start (modulo the curve order).
+            auto secret = first;
+            ec_secret offset{};
+            const auto bytes = to_big_endian<uint64_t>(start);
+            std::copy(bytes.begin(), bytes.end(),
+                std::prev(offset.end(), bytes.size()));
+
+            if (is_nonzero(start) && secp256k1_ec_seckey_tweak_add(verify,
+                secret.data(), offset.data()) != ec_success)
+                return false;
+
+            // Each worker thread signs with its own context.
+            auto const* sign = ec_context_sign::context();
+
+            secp256k1_pubkey pubkey;
+            if (secp256k1_ec_pubkey_create(sign, &pubkey, secret.data()) !=
+                ec_success || !serialize(sign, out[start], pubkey))
+                return false;
+
+            // Point addition (one field inversion) replaces multiplication.
+            // The combine output is cleared first, so it cannot alias a term.
+            secp256k1_pubkey next;
+            for (auto index = add1(start); index < start + size; ++index)
+            {
+                const secp256k1_pubkey* const terms[]{ &pubkey, &generator };
+                if (secp256k1_ec_pubkey_combine(verify, &next, terms, 2) !=
+                    ec_success || !serialize(verify, out[index], next))
+                    return false;
+
+                pubkey = next;
+            }
+
+            return true;
+        });
+}
+
 // Verify keys
 // ----------------------------------------------------------------------------
 
@@ -416,6 +522,18 @@ bool sign(ec_signature& out, const ec_secret& secret,
         secp256k1_nonce_function_rfc6979, nullptr) == ec_success);
 }
 
+bool sign(ec_signature& out, const ec_secret& secret, const hash_digest& hash,
+    const hash_digest& entropy) NOEXCEPT
+{
+    const auto context = ec_context_sign::context();
+    const auto signature = pointer_cast<secp256k1_ecdsa_signature>(
+        out.data());
+
+    // RFC6979 mixes the 32 bytes of entropy into its nonce derivation.
+    return (secp256k1_ecdsa_sign(context, signature, hash.data(), secret.data(),
+        secp256k1_nonce_function_rfc6979, entropy.data()) == ec_success);
+}
+
 // parse<>, verify<>
 bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT
@@ -466,5 +584,23 @@ bool recover_public(ec_uncompressed& out,
     return recover_public(context, out, recoverable, hash);
 }
 
+// Signing context
+// ----------------------------------------------------------------------------
+
+bool ec_randomize_context() NOEXCEPT
+{
+    return ec_context_sign::randomize();
+}
+
+bool ec_randomize_context(ec_entropy source) NOEXCEPT
+{
+    return ec_context_sign::randomize(source);
+}
+
+void ec_release_context() NOEXCEPT
+{
+    ec_context_sign::release();
+}
+
 } // namespace system
 } // namespace libbitcoin
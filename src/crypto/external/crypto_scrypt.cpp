@@ -28,14 +28,22 @@
  */
 #include <bitcoin/system/crypto/external/crypto_scrypt.hpp>
 
-#include <bitcoin/system/define.hpp>
+#include <algorithm>
 #include <bitcoin/system/crypto/external/pbkdf2_sha256.hpp>
+#include <bitcoin/system/data/parallel.hpp>
+#include <bitcoin/system/define.hpp>
+
+#ifdef HAVE_SSE2
+    #include <emmintrin.h>
+#endif
 
+#ifndef HAVE_SSE2
 static void blkcpy(uint8_t*, uint8_t*, size_t);
 static void blkxor(uint8_t*, uint8_t*, size_t);
 static void salsa20_8(uint8_t[64]);
 static void blockmix_salsa8(uint8_t*, uint8_t*, size_t);
 static uint64_t integerify(uint8_t*, size_t);
+#endif
 static void smix(uint8_t* , size_t, uint64_t, uint8_t*, uint8_t*);
 
 // TODO: make constexpr (cpp) and use /math/bytes endians.
@@ -57,6 +65,8 @@ static inline void le32enc(void* pp, uint32_t x)
     p[3] = (x >> 24) & 0xff;
 }
 
+#ifndef HAVE_SSE2
+
 // from_little_end
 static inline uint64_t le64dec(const void* pp)
 {
@@ -227,43 +237,239 @@ static void smix(uint8_t* B, size_t r,
     blkcpy(B, X, 128 * r);
 }
 
+#else // HAVE_SSE2
+
 /**
- * crypto_scrypt(passwd, passwdlen, salt, saltlen, N, r, p, buf, buflen):
- * Compute scrypt(passwd[0 .. passwdlen - 1], salt[0 .. saltlen - 1], N, r,
- * p, buflen) and write the result into buf.  The parameters r, p, and buflen
- * must satisfy r * p < 2^30 and buflen <= (2^32 - 1) * 32.  The parameter N
- * must be a power of 2.
- *
- * Return 0 on success; or -1 on error.
+ * salsa20_8(B):
+ * Apply the salsa20/8 core to the provided block, held as four vectors in
+ * the diagonal order established by smix (word i at position i * 5 % 16).
  */
-int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
-    const uint8_t* salt, size_t salt_length, uint64_t N,
-    uint32_t r, uint32_t p, uint8_t* buf, size_t buf_length)
+static inline __m128i rotl(__m128i x, int n)
+{
+    return _mm_xor_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n));
+}
+
+static void salsa20_8(__m128i B[4])
+{
+    __m128i X0 = B[0];
+    __m128i X1 = B[1];
+    __m128i X2 = B[2];
+    __m128i X3 = B[3];
+    size_t i;
+
+    for (i = 0; i < 8; i += 2)
+    {
+        /* Operate on columns. */
+        X1 = _mm_xor_si128(X1, rotl(_mm_add_epi32(X0, X3), 7));
+        X2 = _mm_xor_si128(X2, rotl(_mm_add_epi32(X1, X0), 9));
+        X3 = _mm_xor_si128(X3, rotl(_mm_add_epi32(X2, X1), 13));
+        X0 = _mm_xor_si128(X0, rotl(_mm_add_epi32(X3, X2), 18));
+
+        /* Rearrange data. */
+        X1 = _mm_shuffle_epi32(X1, 0x93);
+        X2 = _mm_shuffle_epi32(X2, 0x4e);
+        X3 = _mm_shuffle_epi32(X3, 0x39);
+
+        /* Operate on rows. */
+        X3 = _mm_xor_si128(X3, rotl(_mm_add_epi32(X0, X1), 7));
+        X2 = _mm_xor_si128(X2, rotl(_mm_add_epi32(X3, X0), 9));
+        X1 = _mm_xor_si128(X1, rotl(_mm_add_epi32(X2, X3), 13));
+        X0 = _mm_xor_si128(X0, rotl(_mm_add_epi32(X1, X2), 18));
+
+        /* Rearrange data. */
+        X1 = _mm_shuffle_epi32(X1, 0x39);
+        X2 = _mm_shuffle_epi32(X2, 0x4e);
+        X3 = _mm_shuffle_epi32(X3, 0x93);
+    }
+
+    B[0] = _mm_add_epi32(B[0], X0);
+    B[1] = _mm_add_epi32(B[1], X1);
+    B[2] = _mm_add_epi32(B[2], X2);
+    B[3] = _mm_add_epi32(B[3], X3);
+}
+
+static inline void blkxor(__m128i X[4], const uint8_t* B)
+{
+    size_t i;
+
+    for (i = 0; i < 4; i++)
+        X[i] = _mm_xor_si128(X[i], _mm_loadu_si128((const __m128i*)&B[i * 16]));
+}
+
+static inline void blkxor(uint8_t* dest, const uint8_t* src, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i += 16)
+        _mm_storeu_si128((__m128i*)&dest[i], _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)&dest[i]),
+            _mm_loadu_si128((const __m128i*)&src[i])));
+}
+
+static inline void blkstore(uint8_t* B, const __m128i X[4])
+{
+    size_t i;
+
+    for (i = 0; i < 4; i++)
+        _mm_storeu_si128((__m128i*)&B[i * 16], X[i]);
+}
+
+/**
+ * blockmix_salsa8(Bin, Bout, r):
+ * Compute Bout = BlockMix_{salsa20/8, r}(Bin).  The input Bin must be 128r
+ * bytes in length; the output Bout must also be the same size.  The even
+ * (Y_0, Y_2 ...) and odd (Y_1, Y_3 ...) blocks are written in place.
+ */
+static void blockmix_salsa8(const uint8_t* Bin, uint8_t* Bout, size_t r)
+{
+    __m128i X[4];
+    size_t i;
+
+    /* 1: X <-- B_{2r - 1} */
+    for (i = 0; i < 4; i++)
+        X[i] = _mm_loadu_si128((const __m128i*)&Bin[(2 * r - 1) * 64 + i * 16]);
+
+    /* 2: for i = 0 to 2r - 1 do */
+    for (i = 0; i < 2 * r; i++)
+    {
+        /* 3: X <-- H(X \xor B_i) */
+        blkxor(X, &Bin[i * 64]);
+        salsa20_8(X);
+
+        /* 4: Y_i <-- X */
+        /* 6: B' <-- (Y_0, Y_2 ... Y_{2r-2}, Y_1, Y_3 ... Y_{2r-1}) */
+        blkstore(&Bout[((i / 2) + (i % 2) * r) * 64], X);
+    }
+}
+
+/**
+ * smix(B, r, N, V, XY):
+ * Compute B = SMix_r(B, N).  The input B must be 128r bytes in length; the
+ * temporary storage V must be 128rN bytes in length; the temporary storage
+ * XY must be 256r bytes in length.  The value N must be a power of 2.
+ * Words are held in diagonal order (see salsa20_8) between load and store.
+ */
+static void smix(uint8_t* B, size_t r,
+    uint64_t N, uint8_t* V, uint8_t* XY)
+{
+    uint8_t* X = XY;
+    uint8_t* Y = &XY[128 * r];
+    uint64_t i;
+    uint64_t j;
+    size_t k;
+    size_t w;
+
+    /* 1: X <-- B */
+    for (k = 0; k < 2 * r; k++)
+        for (w = 0; w < 16; w++)
+            le32enc(&X[(k * 16 + w) * 4], le32dec(&B[(k * 16 + w * 5 % 16) * 4]));
+
+    /* 2: for i = 0 to N - 1 do */
+    for (i = 0; i + 1 < N; i += 2)
+    {
+        /* 3: V_i <-- X */
+        std::copy_n(X, 128 * r, &V[i * (128 * r)]);
+
+        /* 4: X <-- H(X) */
+        blockmix_salsa8(X, Y, r);
+
+        /* 3: V_i <-- X */
+        std::copy_n(Y, 128 * r, &V[(i + 1) * (128 * r)]);
+
+        /* 4: X <-- H(X) */
+        blockmix_salsa8(Y, X, r);
+    }
+
+    /* Odd N (only N = 1 is a power of 2), single step tail. */
+    if (i < N)
+    {
+        std::copy_n(X, 128 * r, &V[i * (128 * r)]);
+        blockmix_salsa8(X, Y, r);
+        std::copy_n(Y, 128 * r, X);
+    }
+
+    /* 6: for i = 0 to N - 1 do */
+    for (i = 0; i + 1 < N; i += 2)
+    {
+        /* 7: j <-- Integerify(X) mod N (word 1 is at diagonal position 13) */
+        j = (((uint64_t)le32dec(&X[(2 * r - 1) * 64 + 13 * 4]) << 32) +
+            le32dec(&X[(2 * r - 1) * 64])) & (N - 1);
+
+        /* 8: X <-- H(X \xor V_j) */
+        blkxor(X, &V[j * (128 * r)], 128 * r);
+        blockmix_salsa8(X, Y, r);
+
+        /* 7: j <-- Integerify(X) mod N */
+        j = (((uint64_t)le32dec(&Y[(2 * r - 1) * 64 + 13 * 4]) << 32) +
+            le32dec(&Y[(2 * r - 1) * 64])) & (N - 1);
+
+        /* 8: X <-- H(X \xor V_j) */
+        blkxor(Y, &V[j * (128 * r)], 128 * r);
+        blockmix_salsa8(Y, X, r);
+    }
+
+    /* Odd N (only N = 1 is a power of 2), single step tail. */
+    if (i < N)
+    {
+        j = (((uint64_t)le32dec(&X[(2 * r - 1) * 64 + 13 * 4]) << 32) +
+            le32dec(&X[(2 * r - 1) * 64])) & (N - 1);
+
+        blkxor(X, &V[j * (128 * r)], 128 * r);
+        blockmix_salsa8(X, Y, r);
+        std::copy_n(Y, 128 * r, X);
+    }
+
+    /* 10: B' <-- X */
+    for (k = 0; k < 2 * r; k++)
+        for (w = 0; w < 16; w++)
+            le32enc(&B[(k * 16 + w * 5 % 16) * 4], le32dec(&X[(k * 16 + w) * 4]));
+}
+
+#endif // HAVE_SSE2
+
+/**
+ * smix_lanes(B, r, N, V, XY, p, first, stride):
+ * Compute B_i = SMix_r(B_i, N) for lanes first, first + stride ... < p, with
+ * the lanes sharing the single V and XY working memory.
+ */
+static void smix_lanes(uint8_t* B, size_t r, uint64_t N, uint8_t* V,
+    uint8_t* XY, uint32_t p, uint32_t first, uint32_t stride)
 {
-    uint8_t* B;
-    uint8_t* V;
-    uint8_t* XY;
     uint32_t i;
 
+    for (i = first; i < p; i += stride)
+        smix(&B[i * 128 * r], r, N, V, XY);
+}
+
+/**
+ * crypto_scrypt_check(N, r, p, buf_length):
+ * Return 0 if the parameters are valid and buffers are addressable; or -1
+ * (with errno set) on error.
+ */
+static int crypto_scrypt_check(uint64_t N, uint32_t r, uint32_t p,
+    size_t buf_length)
+{
     /* Sanity-check parameters. */
 #if SIZE_MAX > UINT32_MAX
     if (buf_length > (((uint64_t)(1) << 32) - 1) * 32)
     {
         errno = EFBIG;
-        goto err0;
+        return (-1);
     }
+#else
+    (void)buf_length;
 #endif
 
     if ((uint64_t)(r) * (uint64_t)(p) >= (1 << 30))
     {
         errno = EFBIG;
-        goto err0;
+        return (-1);
     }
 
     if (((N & (N - 1)) != 0) || (N == 0))
     {
         errno = EINVAL;
-        goto err0;
+        return (-1);
     }
 
     if ((r > SIZE_MAX / 128 / p) ||
@@ -273,47 +479,126 @@ int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
         (N > SIZE_MAX / 128 / r))
     {
         errno = ENOMEM;
-        goto err0;
+        return (-1);
     }
 
-    /* Allocate memory. */
-    if ((B = reinterpret_cast<uint8_t*>(malloc(128 * r * p))) == nullptr)
-        goto err0;
+    return (0);
+}
 
-    if ((XY = reinterpret_cast<uint8_t*>(malloc(256 * r))) == nullptr)
-        goto err1;
+uint32_t crypto_scrypt_threads(uint32_t p)
+{
+    const auto cores = (uint32_t)std::min<size_t>(
+        libbitcoin::system::parallel_threads(), UINT32_MAX);
+    return std::max(1u, std::min(p, cores));
+}
 
-    if ((V = reinterpret_cast<uint8_t*>(malloc(128 * r * (size_t)N))) == nullptr)
-        goto err2;
+int crypto_scrypt_sizes(uint64_t N, uint32_t r, uint32_t p, uint32_t threads,
+    size_t* B_length, size_t* XY_length, size_t* V_length)
+{
+    if (crypto_scrypt_check(N, r, p, 0) != 0)
+        return (-1);
+
+    threads = std::max(1u, std::min(p, threads));
+    if ((256 * r > SIZE_MAX / threads) ||
+        (128 * r * (size_t)N > SIZE_MAX / threads))
+    {
+        errno = ENOMEM;
+        return (-1);
+    }
+
+    *B_length = 128 * r * p;
+    *XY_length = 256 * r * threads;
+    *V_length = 128 * r * (size_t)N * threads;
+    return (0);
+}
+
+int crypto_scrypt_buffers(const uint8_t* passphrase, size_t passphrase_length,
+    const uint8_t* salt, size_t salt_length, uint64_t N, uint32_t r,
+    uint32_t p, uint8_t* buf, size_t buf_length, uint32_t threads,
+    uint8_t* B, uint8_t* XY, uint8_t* V)
+{
+    if (crypto_scrypt_check(N, r, p, buf_length) != 0)
+        return (-1);
+
+    threads = std::max(1u, std::min(p, threads));
 
     /* 1: (B_0 ... B_{p-1}) <-- PBKDF2(P, S, 1, p * MFLen) */
     pbkdf2_sha256(passphrase, passphrase_length,
         salt, salt_length, 1, B, p * 128 * r);
 
     /* 2: for i = 0 to p - 1 do */
-    for (i = 0; i < p; i++)
+    /* 3: B_i <-- MF(B_i, N) */
+    /* Lanes are independent, each worker has its own V and XY. */
+    libbitcoin::system::parallel_for(threads, [&](size_t worker) NOEXCEPT
     {
-        /* 3: B_i <-- MF(B_i, N) */
-        smix(&B[i * 128 * r], r, N, V, XY);
-    }
+        smix_lanes(B, r, N, &V[worker * 128 * r * (size_t)N],
+            &XY[worker * 256 * r], p, (uint32_t)worker, threads);
+    });
 
     /* 5: DK <-- PBKDF2(P, B, 1, dkLen) */
     pbkdf2_sha256(passphrase, passphrase_length,
         B, p * 128 * r, 1, buf, buf_length);
 
+    return (0);
+}
+
+/**
+ * crypto_scrypt(passwd, passwdlen, salt, saltlen, N, r, p, buf, buflen):
+ * Compute scrypt(passwd[0 .. passwdlen - 1], salt[0 .. saltlen - 1], N, r,
+ * p, buflen) and write the result into buf.  The parameters r, p, and buflen
+ * must satisfy r * p < 2^30 and buflen <= (2^32 - 1) * 32.  The parameter N
+ * must be a power of 2.
+ *
+ * Return 0 on success; or -1 on error.
+ */
+int crypto_scrypt(const uint8_t* passphrase, size_t passphrase_length,
+    const uint8_t* salt, size_t salt_length, uint64_t N,
+    uint32_t r, uint32_t p, uint8_t* buf, size_t buf_length)
+{
+    uint32_t threads = crypto_scrypt_threads(p);
+    size_t B_length, XY_length, V_length;
+    uint8_t* B;
+    uint8_t* V;
+    uint8_t* XY;
+    int result;
+
+  retry:
+    if (crypto_scrypt_sizes(N, r, p, threads, &B_length, &XY_length,
+        &V_length) != 0)
+        goto err0;
+
+    /* Allocate memory. */
+    if ((B = reinterpret_cast<uint8_t*>(malloc(B_length))) == nullptr)
+        goto err0;
+
+    if ((XY = reinterpret_cast<uint8_t*>(malloc(XY_length))) == nullptr)
+        goto err1;
+
+    if ((V = reinterpret_cast<uint8_t*>(malloc(V_length))) == nullptr)
+        goto err2;
+
+    result = crypto_scrypt_buffers(passphrase, passphrase_length, salt,
+        salt_length, N, r, p, buf, buf_length, threads, B, XY, V);
+
     /* Free memory. */
     free(V);
     free(XY);
     free(B);
 
-    /* Success! */
-    return (0);
+    return (result);
 
   err2:
     free(XY);
   err1:
     free(B);
   err0:
+    /* Parallel V is threads times larger, fall back to the serial size. */
+    if (threads > 1)
+    {
+        threads = 1;
+        goto retry;
+    }
+
     /* Failure! */
     return (-1);
 }
@@ -32,6 +32,8 @@ int pkcs5_pbkdf2(const uint8_t* passphrase, size_t passphrase_length,
     uint8_t buffer[HMACSHA512_DIGEST_LENGTH];
     uint8_t digest1[HMACSHA512_DIGEST_LENGTH];
     uint8_t digest2[HMACSHA512_DIGEST_LENGTH];
+    HMACSHA512CTX midstate;
+    HMACSHA512CTX context;
 
     /* An iteration count of 0 is equivalent to a count of 1. */
     /* A key_length of 0 is a no-op. */
@@ -44,6 +46,9 @@ int pkcs5_pbkdf2(const uint8_t* passphrase, size_t passphrase_length,
     if (asalt == NULL)
         return -1;
 
+    /* The key is hashed into inner and outer pad midstates only once. */
+    HMACSHA512Init(&midstate, passphrase, passphrase_length);
+
     memcpy(asalt, salt, salt_length);
     for (count = 1; key_length > 0; count++)
     {
@@ -51,13 +56,16 @@ int pkcs5_pbkdf2(const uint8_t* passphrase, size_t passphrase_length,
         asalt[salt_length + 1] = (count >> 16) & 0xff;
         asalt[salt_length + 2] = (count >> 8) & 0xff;
         asalt[salt_length + 3] = (count >> 0) & 0xff;
-        HMACSHA512(asalt, asalt_size, passphrase, passphrase_length, digest1);
+        context = midstate;
+        HMACSHA512Update(&context, asalt, asalt_size);
+        HMACSHA512Final(&context, digest1);
         memcpy(buffer, digest1, sizeof(buffer));
 
         for (iteration = 1; iteration < iterations; iteration++)
         {
-            HMACSHA512(digest1, sizeof(digest1), passphrase, passphrase_length,
-                digest2);
+            context = midstate;
+            HMACSHA512Update(&context, digest1, sizeof(digest1));
+            HMACSHA512Final(&context, digest2);
             memcpy(digest1, digest2, sizeof(digest1));
             for (index = 0; index < sizeof(buffer); index++)
                 buffer[index] ^= digest1[index];
@@ -25,6 +25,7 @@
  */
 #include <bitcoin/system/crypto/external/sha512.hpp>
 
+#include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/define.hpp>
 
 // TODO: make constexpr (cpp) and use /math/bytes endians.
@@ -108,8 +109,6 @@ static unsigned char PAD[SHA512_BLOCK_LENGTH] =
 };
 
 void SHA512Pad(SHA512CTX* context);
-void SHA512Transform(uint64_t state[SHA512_STATE_LENGTH],
-    const uint8_t block[SHA512_BLOCK_LENGTH]);
 
 void SHA512(const uint8_t* input, size_t length,
     uint8_t digest[SHA512_DIGEST_LENGTH])
@@ -156,14 +155,14 @@ void SHA512Update(SHA512CTX* context, const uint8_t* input, size_t length)
     }
 
     memcpy(&context->buf[r], input, 128 - r);
-    SHA512Transform(context->state, context->buf);
+    bc::system::intrinsics::sha512_single(context->state, context->buf);
 
     input += 128 - r;
     length -= 128 - r;
 
     while (length >= 128) 
     {
-        SHA512Transform(context->state, input);
+        bc::system::intrinsics::sha512_single(context->state, input);
         input += 128;
         length -= 128;
     }
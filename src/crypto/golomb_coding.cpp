@@ -57,11 +57,16 @@ static uint64_t decode(bitreader& source, uint8_t modulo_exponent) NOEXCEPT
     return ((quotient << modulo_exponent) + remainder);
 }
 
+inline uint64_t hash_to_range(uint64_t hash, uint64_t bound) NOEXCEPT
+{
+    const auto product = uint128_t(hash) * uint128_t(bound);
+    return (product >> bits<uint64_t>).convert_to<uint64_t>();
+}
+
 inline uint64_t hash_to_range(const data_slice& item, uint64_t bound,
     const siphash_key& key) NOEXCEPT
 {
-    const auto product = uint128_t(siphash(key, item)) * uint128_t(bound);
-    return (product >> bits<uint64_t>).convert_to<uint64_t>();
+    return hash_to_range(siphash(key, item), bound);
 }
 
 static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
@@ -73,15 +78,10 @@ static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
         return {};
 
     const auto bound = target_false_positive_rate * set_size;
-    static no_fill_allocator<uint64_t> no_fill_uint64_allocator{};
-    std::vector<uint64_t> hashes(items.size(), no_fill_uint64_allocator);
+    auto hashes = siphash_batch(key, items);
 
-    // C++17: parallel policy for std::transform.
-    std::transform(items.begin(), items.end(), hashes.begin(),
-        [&](const data_chunk& item) NOEXCEPT
-        {
-            return hash_to_range(item, bound, key);
-        });
+    for (auto& hash: hashes)
+        hash = hash_to_range(hash, bound);
 
     return sort(std::move(hashes));
 }
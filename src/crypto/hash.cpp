@@ -21,7 +21,9 @@
 #include <vector>
 #include <bitcoin/system/crypto/external/external.hpp>
 #include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/crypto/pseudo_random.hpp>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -68,17 +70,41 @@ short_hash bitcoin_short_hash(const data_slice& data) NOEXCEPT
     return ripemd160_hash(sha256_hash(data));
 }
 
+short_hash_list bitcoin_short_hashes(
+    const std::vector<data_slice>& data) NOEXCEPT
+{
+    const auto count = data.size();
+    if (is_zero(count))
+        return {};
+
+    std::vector<const uint8_t*> messages(count);
+    std::vector<size_t> sizes(count);
+
+    for (auto index = zero; index < count; ++index)
+    {
+        messages[index] = data[index].data();
+        sizes[index] = data[index].size();
+    }
+
+    // std::vector<std::array<uint8_t, N>>.data() is size * N contiguous bytes.
+    short_hash_list hashes(count);
+    intrinsics::hash160_multiple(hashes.front().data(), messages.data(),
+        sizes.data(), count);
+
+    return hashes;
+}
+
 short_hash ripemd160_hash(const data_slice& data) NOEXCEPT
 {
     short_hash hash;
-    RMD160(data.data(), data.size(), hash.data());
+    intrinsics::ripemd160(data.data(), data.size(), hash.data());
     return hash;
 }
 
 data_chunk ripemd160_hash_chunk(const data_slice& data) NOEXCEPT
 {
     data_chunk hash(short_hash_size, no_fill_byte_allocator);
-    RMD160(data.data(), data.size(), hash.data());
+    intrinsics::ripemd160(data.data(), data.size(), hash.data());
     return hash;
 }
 
@@ -143,7 +169,7 @@ data_chunk pbkdf2_hmac_sha256_chunk(const data_slice& passphrase,
 long_hash sha512_hash(const data_slice& data) NOEXCEPT
 {
     long_hash hash;
-    SHA512(data.data(), data.size(), hash.data());
+    intrinsics::sha512(data.data(), data.size(), hash.data());
     return hash;
 }
 
@@ -194,5 +220,18 @@ size_t djb2_hash(const data_slice& data) NOEXCEPT
     return hash;
 }
 
+uint64_t hash_salt() NOEXCEPT
+{
+    // The twister is clock seeded (enumerable), so it is only a fallback.
+    static const auto salt = []() NOEXCEPT
+    {
+        data_array<sizeof(uint64_t)> bytes{};
+        return pseudo_random::entropy(bytes) ? from_little_endian(bytes) :
+            pseudo_random::next<uint64_t>();
+    }();
+
+    return salt;
+}
+
 } // namespace system
 } // namespace libbitcoin
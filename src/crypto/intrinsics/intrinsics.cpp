@@ -18,7 +18,11 @@
  */
 #include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <immintrin.h>
 
 #ifdef HAVE_MSC
@@ -27,11 +31,18 @@
 #endif
 
 #include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
 #include <bitcoin/system/crypto/external/external.hpp>
 #include <bitcoin/system/crypto/hash.hpp>
+#include <bitcoin/system/crypto/siphash.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
 namespace system {
@@ -39,12 +50,13 @@ namespace intrinsics {
 
 namespace cpu1_0
 {
-#if defined(WITH_AVX2) || defined(WITH_SSE41) || defined(WITH_SSE4) || defined(WITH_SHANI)
+#if defined(WITH_AVX512) || defined(WITH_AVX2) || defined(WITH_SSE41) || \
+    defined(WITH_SSE4) || defined(WITH_SHANI)
     constexpr auto leaf = 1_u32;
     constexpr auto subleaf = 0_u32;
     constexpr auto sse4_ecx_bit = 19_size;
 #endif
-#if defined(WITH_AVX2)
+#if defined(WITH_AVX512) || defined(WITH_AVX2)
     constexpr auto xsave_ecx_bit = 27_size;
     constexpr auto avx_ecx_bit = 28_size;
 #endif
@@ -52,13 +64,16 @@ namespace cpu1_0
 
 namespace cpu7_0
 {
-#if defined(WITH_AVX2) || defined(WITH_SHANI)
+#if defined(WITH_AVX512) || defined(WITH_AVX2) || defined(WITH_SHANI)
     constexpr auto leaf = 7_u32;
     constexpr auto subleaf = 0_u32;
 #endif
 #if defined(WITH_AVX2)
     constexpr auto avx2_ebx_bit = 5_size;
 #endif
+#if defined(WITH_AVX512)
+    constexpr auto avx512f_ebx_bit = 16_size;
+#endif
 #if defined(WITH_SHANI)
     constexpr auto shani_ebx_bit = 29_size;
 #endif
@@ -66,17 +81,22 @@ namespace cpu7_0
 
 namespace xcr0
 {
-#if defined(WITH_AVX2)
+#if defined(WITH_AVX512) || defined(WITH_AVX2)
     constexpr auto feature = 0_u32;
     constexpr auto sse_bit = 1_size;
     constexpr auto avx_bit = 2_size;
 #endif
+#if defined(WITH_AVX512)
+    constexpr auto opmask_bit = 5_size;
+    constexpr auto zmm_hi256_bit = 6_size;
+    constexpr auto hi16_zmm_bit = 7_size;
+#endif
 }
 
 // In msvc intrinsics always compile, however on other platforms this support
 // is unreliable, so we revert to the lowest common interface (assembly).
 
-#if defined(WITH_AVX2)
+#if defined(WITH_AVX512) || defined(WITH_AVX2)
 static bool xgetbv(uint64_t& value, uint32_t index) NOEXCEPT
 {
 #if defined(__x86_64__) || defined(__amd64__) || defined(__i386__)
@@ -97,7 +117,8 @@ static bool xgetbv(uint64_t& value, uint32_t index) NOEXCEPT
 }
 #endif
 
-#if defined(WITH_AVX2) || defined(WITH_SSE41) || defined(WITH_SSE4) || defined(WITH_SHANI)
+#if defined(WITH_AVX512) || defined(WITH_AVX2) || defined(WITH_SSE41) || \
+    defined(WITH_SSE4) || defined(WITH_SHANI)
 static bool cpuid_ex(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d,
     uint32_t leaf, uint32_t subleaf) NOEXCEPT
 {
@@ -123,6 +144,30 @@ static bool cpuid_ex(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d,
 // runtime checks for intrinsic availability
 // ----------------------------------------------------------------------------
 
+#ifdef WITH_AVX512
+inline bool try_avx512() NOEXCEPT
+{
+    // The OS must preserve opmask and all zmm state (xcr0), as well as ymm.
+    uint64_t extended;
+    uint32_t eax, ebx, ecx, edx;
+    return cpuid_ex(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
+        && get_right(ecx, cpu1_0::xsave_ecx_bit)
+        && get_right(ecx, cpu1_0::avx_ecx_bit)
+        && xgetbv(extended, xcr0::feature)
+        && get_right(extended, xcr0::sse_bit)
+        && get_right(extended, xcr0::avx_bit)
+        && get_right(extended, xcr0::opmask_bit)
+        && get_right(extended, xcr0::zmm_hi256_bit)
+        && get_right(extended, xcr0::hi16_zmm_bit)
+        && cpuid_ex(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
+        && get_right(ebx, cpu7_0::avx512f_ebx_bit);
+}
+bool have_avx512() NOEXCEPT
+{
+    static auto enable = try_avx512();
+    return enable;
+}
+#endif
 #ifdef WITH_AVX2
 inline bool try_avx2() NOEXCEPT
 {
@@ -204,9 +249,17 @@ bool have_shani() NOEXCEPT
 }
 #endif
 
+#ifdef WITH_AVX512
+void sha256_x16_avx512(uint32_t* const states[16], const uint8_t* const blocks[16]) NOEXCEPT;
+void double_sha256_x16_avx512(uint8_t* out, const uint8_t in[16 * 64]) NOEXCEPT;
+#endif
 #ifdef WITH_AVX2
 void sha256_x1_avx2(uint32_t state[8], const uint8_t block[64]) NOEXCEPT;
+void sha256_x8_avx2(uint32_t* const states[8], const uint8_t* const blocks[8]) NOEXCEPT;
 void double_sha256_x8_avx2(uint8_t* out, const uint8_t in[8 * 64]) NOEXCEPT;
+void ripemd160_x8_avx2(uint32_t* const states[8], const uint8_t* const blocks[8]) NOEXCEPT;
+void sha512_x1_avx2(uint64_t state[8], const uint8_t block[128]) NOEXCEPT;
+void siphash_x4_avx2(uint64_t out[4], const uint64_t key[2], const uint8_t* const messages[4], const size_t sizes[4]) NOEXCEPT;
 #endif
 #ifdef WITH_NEON
 void sha256_x1_neon(uint32_t state[8], const uint8_t block[64]) NOEXCEPT;
@@ -215,7 +268,9 @@ void double_sha256_x1_neon(uint8_t* out, const uint8_t in[1 * 64]) NOEXCEPT;
 #endif
 #ifdef WITH_SSE41
 void sha256_x1_sse41(uint32_t state[8], const uint8_t block[64]) NOEXCEPT;
+void sha256_x4_sse41(uint32_t* const states[4], const uint8_t* const blocks[4]) NOEXCEPT;
 void double_sha256_x4_sse41(uint8_t* out, const uint8_t in[4 * 64]) NOEXCEPT;
+void ripemd160_x4_sse41(uint32_t* const states[4], const uint8_t* const blocks[4]) NOEXCEPT;
 #endif
 #ifdef WITH_SSE4
 void sha256_x1_sse4(uint32_t state[8], const uint8_t block[64]) NOEXCEPT;
@@ -228,131 +283,780 @@ void double_sha256_x2_shani(uint8_t* out, const uint8_t in[2 * 64]) NOEXCEPT;
 void double_sha256_x1_shani(uint8_t* out, const uint8_t in[1 * 64]) NOEXCEPT;
 #endif
 
-// single sha256
+// multiple sha256
 // ----------------------------------------------------------------------------
 
-// Iterate over contibuous blocks, with hash accumulation in 'state'. This can
-// be used to replace SHA256Transform.
-void sha256_single(uint32_t state[8], const uint8_t block[64]) NOEXCEPT
+// The full blocks of a message are read in place, and its final one or two
+// blocks (remainder, padding and bit count) are composed into the lane pad.
+struct sha256_lane
 {
-#ifdef WITH_SHANI
-    if (have_shani())
+    const uint8_t* message;
+    size_t index;
+    size_t full;
+    size_t blocks;
+    size_t next;
+    std::array<uint32_t, 8> state;
+    std::array<uint8_t, 2 * 64> pad;
+};
+
+static void load_lane(sha256_lane& lane, const uint8_t* message, size_t size,
+    size_t index) NOEXCEPT
+{
+    constexpr auto block_size = 64_size;
+    constexpr auto count_size = sizeof(uint64_t);
+    const auto remainder = size % block_size;
+
+    lane.message = message;
+    lane.index = index;
+    lane.full = size / block_size;
+    lane.blocks = lane.full + (remainder + add1(count_size) > block_size ?
+        two : one);
+    lane.next = zero;
+    lane.state = sha256_initial;
+
+    const auto pad_size = (lane.blocks - lane.full) * block_size;
+    const auto tail = std::next(message, lane.full * block_size);
+    std::copy_n(tail, remainder, lane.pad.begin());
+    std::fill(std::next(lane.pad.begin(), remainder),
+        std::next(lane.pad.begin(), pad_size), 0x00_u8);
+    lane.pad[remainder] = 0x80;
+
+    const auto bits = to_big_endian(shift_left(possible_narrow_cast<uint64_t>(
+        size), 3_size));
+    std::copy_n(bits.begin(), count_size,
+        std::next(lane.pad.begin(), pad_size - count_size));
+}
+
+static const uint8_t* lane_block(const sha256_lane& lane) NOEXCEPT
+{
+    constexpr auto block_size = 64_size;
+
+    return lane.next < lane.full ?
+        std::next(lane.message, lane.next * block_size) :
+        std::next(lane.pad.data(), (lane.next - lane.full) * block_size);
+}
+
+static void store_lane(uint8_t out[], const sha256_lane& lane) NOEXCEPT
+{
+    constexpr auto count = 32_size / sizeof(uint32_t);
+
+    to_big_endian_set(
+        unsafe_array_cast<uint32_t, count>(&out[lane.index * hash_size]),
+        array_cast<uint32_t, count>(lane.state));
+}
+
+// Messages are loaded into lanes as lanes complete. Lanes without a message
+// are masked (compressed over scratch and discarded). Once there is nothing
+// left to interleave, a sole remaining message is completed in a single lane.
+template <size_t Lanes, void(*Compress)(uint32_t* const[Lanes],
+    const uint8_t* const[Lanes]) NOEXCEPT>
+static void sha256_lanes(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT
+{
+    std::array<sha256_lane, Lanes> lanes;
+    std::array<bool, Lanes> active{};
+    std::array<uint32_t, 8> scratch_state{};
+    std::array<uint8_t, 64> scratch_block{};
+    std::array<uint32_t*, Lanes> states{};
+    std::array<const uint8_t*, Lanes> blocks{};
+    auto loaded = zero;
+    auto running = zero;
+
+    for (auto lane = zero; lane < Lanes && loaded < count; ++lane, ++loaded)
     {
-        sha256_x1_shani(state, block);
-        return;
+        load_lane(lanes[lane], in[loaded], sizes[loaded], loaded);
+        active[lane] = true;
+        ++running;
     }
-#endif
-////#ifdef WITH_AVX2
-////    if (have_avx2())
-////    {
-////        sha256_x1_avx2(state, block);
-////        return;
-////    }
-////#endif
-////#ifdef WITH_SSE41
-////    if (have_sse41())
-////    {
-////        sha256_x1_sse41(state, block);
-////        return;
-////    }
-////#endif
-#ifdef WITH_NEON
-    if (have_neon())
+
+    // A lane is only released once all messages are loaded.
+    while (running > one)
     {
-        sha256_x1_neon(state, block);
-        return;
+        for (auto lane = zero; lane < Lanes; ++lane)
+        {
+            states[lane] = active[lane] ? lanes[lane].state.data() :
+                scratch_state.data();
+            blocks[lane] = active[lane] ? lane_block(lanes[lane]) :
+                scratch_block.data();
+        }
+
+        Compress(states.data(), blocks.data());
+
+        for (auto lane = zero; lane < Lanes; ++lane)
+        {
+            if (!active[lane] || ++lanes[lane].next < lanes[lane].blocks)
+                continue;
+
+            store_lane(out, lanes[lane]);
+
+            if (loaded < count)
+            {
+                load_lane(lanes[lane], in[loaded], sizes[loaded], loaded);
+                ++loaded;
+            }
+            else
+            {
+                active[lane] = false;
+                --running;
+            }
+        }
     }
-#endif
-#ifdef WITH_SSE4
-    if (have_sse4())
+
+    for (auto lane = zero; lane < Lanes; ++lane)
     {
-        sha256_x1_sse4(state, block);
-        return;
+        if (!active[lane])
+            continue;
+
+        auto& remaining = lanes[lane];
+        for (; remaining.next < remaining.blocks; ++remaining.next)
+            sha256_single(remaining.state.data(), lane_block(remaining));
+
+        store_lane(out, remaining);
     }
-#endif
+}
 
-    sha256_x1_portable(state, block);
+// Independent messages hashed one at a time, where lanes do not pay (sha-ni).
+static void sha256_serial(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT
+{
+    for (auto index = zero; index < count; ++index)
+        sha256(in[index], sizes[index], &out[index * hash_size]);
 }
 
-// paired double sha256
+// other hashes
 // ----------------------------------------------------------------------------
 
-// Multiple blocks are hashed independently into an array of hash values stored
-// into 'out'. This is used to reduce hash sets during merkle tree computation.
-void sha256_paired_double(uint8_t out[], const uint8_t in[],
-    size_t blocks) NOEXCEPT
+static void ripemd160_portable(const uint8_t input[], size_t size,
+    uint8_t digest[]) NOEXCEPT
+{
+    RMD160(input, size, digest);
+}
+
+static void sha512_portable(const uint8_t input[], size_t size,
+    uint8_t digest[]) NOEXCEPT
+{
+    SHA512(input, size, digest);
+}
+
+void sha512_x1_portable(uint64_t state[8], const uint8_t block[128]) NOEXCEPT
+{
+    SHA512Transform(state, block);
+}
+
+// Each sha256 digest is padded to a single ripemd160 block (count of 256 bits,
+// little endian), so hash160 finalization is one compression per lane.
+constexpr std::array<uint8_t, 64> ripemd160_digest_padding
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // <=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  // <=
+};
+
+constexpr std::array<uint32_t, 5> ripemd160_initial
+{
+    0x67452301_u32, 0xefcdab89_u32, 0x98badcfe_u32, 0x10325476_u32,
+    0xc3d2e1f0_u32
+};
+
+// Unused lanes of a final partial set are compressed over stale blocks.
+template <size_t Lanes, void(*Compress)(uint32_t* const[Lanes],
+    const uint8_t* const[Lanes]) NOEXCEPT>
+static void ripemd160_digests(uint8_t out[], const uint8_t digests[],
+    size_t count) NOEXCEPT
+{
+    constexpr auto words = short_hash_size / sizeof(uint32_t);
+    std::array<std::array<uint32_t, words>, Lanes> lane_states;
+    std::array<std::array<uint8_t, 64>, Lanes> lane_blocks;
+    std::array<uint32_t*, Lanes> states{};
+    std::array<const uint8_t*, Lanes> blocks{};
+
+    for (auto lane = zero; lane < Lanes; ++lane)
+    {
+        lane_blocks[lane] = ripemd160_digest_padding;
+        states[lane] = lane_states[lane].data();
+        blocks[lane] = lane_blocks[lane].data();
+    }
+
+    for (auto first = zero; first < count; first += Lanes)
+    {
+        const auto used = std::min(Lanes, count - first);
+
+        for (auto lane = zero; lane < Lanes; ++lane)
+        {
+            lane_states[lane] = ripemd160_initial;
+            if (lane < used)
+                std::copy_n(&digests[(first + lane) * hash_size], hash_size,
+                    lane_blocks[lane].begin());
+        }
+
+        Compress(states.data(), blocks.data());
+
+        for (auto lane = zero; lane < used; ++lane)
+            to_little_endian_set(unsafe_array_cast<uint32_t, words>(
+                &out[(first + lane) * short_hash_size]), lane_states[lane]);
+    }
+}
+
+static void ripemd160_digests_portable(uint8_t out[], const uint8_t digests[],
+    size_t count) NOEXCEPT
+{
+    for (auto index = zero; index < count; ++index)
+        ripemd160_portable(&digests[index * hash_size], hash_size,
+            &out[index * short_hash_size]);
+}
+
+// nonce scanning
+// ----------------------------------------------------------------------------
+
+// True if the big endian state (a little endian hash) is at or below target.
+// Compares from the most significant byte, so generally exits on the first.
+static bool is_at_or_below(const std::array<uint32_t, 8>& state,
+    const uint8_t target[32]) NOEXCEPT
+{
+    for (auto byte = sub1(hash_size); byte < hash_size; --byte)
+    {
+        const auto shift = to_bits(sub1(sizeof(uint32_t)) -
+            byte % sizeof(uint32_t));
+        const auto value = narrow_cast<uint8_t>(
+            state[byte / sizeof(uint32_t)] >> shift);
+
+        if (value != target[byte])
+            return value < target[byte];
+    }
+
+    return true;
+}
+
+// Adapts the selected single transform to the lanes interface.
+static void sha256_x1_lanes(uint32_t* const states[1],
+    const uint8_t* const blocks[1]) NOEXCEPT
+{
+    sha256_single(states[0], blocks[0]);
+}
+
+// The first 64 bytes of the header are compressed once (midstate). Each lane
+// then compresses the 16 byte header tail (ending with its nonce) and padding
+// from the midstate, and the resulting digest (padded) from the initial state.
+template <size_t Lanes, void(*Compress)(uint32_t* const[Lanes],
+    const uint8_t* const[Lanes]) NOEXCEPT>
+static bool sha256_nonce_lanes(uint32_t& nonce, const uint8_t header[80],
+    uint32_t first, uint32_t count, const uint8_t target[32]) NOEXCEPT
 {
     constexpr auto block_size = 64_size;
+    constexpr auto tail_size = 16_size;
+    constexpr auto nonce_offset = 12_size;
+    constexpr auto words = hash_size / sizeof(uint32_t);
 
-#ifdef WITH_SHANI
-    if (have_shani())
+    auto midstate = sha256_initial;
+    sha256_single(midstate.data(), header);
+
+    std::array<std::array<uint8_t, 64>, Lanes> tails;
+    std::array<std::array<uint8_t, 64>, Lanes> digests;
+    std::array<std::array<uint32_t, 8>, Lanes> lane_states;
+    std::array<uint32_t*, Lanes> states{};
+    std::array<const uint8_t*, Lanes> tail_blocks{};
+    std::array<const uint8_t*, Lanes> digest_blocks{};
+
+    for (auto lane = zero; lane < Lanes; ++lane)
+    {
+        // Padding and the bit count of the 80 byte header (640 = 0x0280).
+        tails[lane].fill(0x00);
+        std::copy_n(&header[block_size], tail_size, tails[lane].begin());
+        tails[lane][tail_size] = 0x80;
+        tails[lane][62] = 0x02;
+        tails[lane][63] = 0x80;
+
+        digests[lane] = sha256x2_buffer;
+        states[lane] = lane_states[lane].data();
+        tail_blocks[lane] = tails[lane].data();
+        digest_blocks[lane] = digests[lane].data();
+    }
+
+    for (uint64_t offset = 0; offset < count; offset += Lanes)
     {
-        while (blocks >= 2_size)
+        const auto used = std::min<uint64_t>(Lanes, count - offset);
+
+        for (auto lane = zero; lane < Lanes; ++lane)
+        {
+            const auto bytes = to_little_endian(
+                narrow_cast<uint32_t>(first + offset + lane));
+            std::copy(bytes.begin(), bytes.end(),
+                std::next(tails[lane].begin(), nonce_offset));
+            lane_states[lane] = midstate;
+        }
+
+        Compress(states.data(), tail_blocks.data());
+
+        for (auto lane = zero; lane < Lanes; ++lane)
         {
-            double_sha256_x2_shani(out, in);
-            std::advance(out, hash_size * 2_size);
-            std::advance(in, block_size * 2_size);
-            blocks -= 2_size;
+            to_big_endian_set(unsafe_array_cast<uint32_t, words>(
+                digests[lane].data()), lane_states[lane]);
+            lane_states[lane] = sha256_initial;
         }
 
-        while (blocks >= 1_size)
+        Compress(states.data(), digest_blocks.data());
+
+        for (auto lane = zero; lane < used; ++lane)
         {
-            double_sha256_x1_shani(out, in);
-            std::advance(out, hash_size * 1_size);
-            std::advance(in, block_size * 1_size);
-            blocks -= 1_size;
+            if (is_at_or_below(lane_states[lane], target))
+            {
+                nonce = narrow_cast<uint32_t>(first + offset + lane);
+                return true;
+            }
         }
     }
+
+    return false;
+}
+
+// multiple siphash
+// ----------------------------------------------------------------------------
+
+// Unused lanes of a final partial set are hashed over an empty message.
+template <size_t Lanes, void(*Hash)(uint64_t[Lanes], const uint64_t[2],
+    const uint8_t* const[Lanes], const size_t[Lanes]) NOEXCEPT>
+static void siphash_lanes(uint64_t out[], const uint64_t key[2],
+    const uint8_t* const in[], const size_t sizes[], size_t count) NOEXCEPT
+{
+    std::array<uint64_t, Lanes> hashes{};
+    std::array<const uint8_t*, Lanes> messages{};
+    std::array<size_t, Lanes> lengths{};
+
+    for (auto first = zero; first < count; first += Lanes)
+    {
+        const auto used = std::min(Lanes, count - first);
+        std::copy_n(&in[first], used, messages.begin());
+        std::copy_n(&sizes[first], used, lengths.begin());
+        std::fill(std::next(lengths.begin(), used), lengths.end(), zero);
+
+        Hash(hashes.data(), key, messages.data(), lengths.data());
+        std::copy_n(hashes.begin(), used, &out[first]);
+    }
+}
+
+static void siphash_serial(uint64_t out[], const uint64_t key[2],
+    const uint8_t* const in[], const size_t sizes[], size_t count) NOEXCEPT
+{
+    const auto tuple = std::make_tuple(key[0], key[1]);
+    for (auto index = zero; index < count; ++index)
+        out[index] = siphash(tuple,
+            { in[index], std::next(in[index], sizes[index]) });
+}
+
+// kernel dispatch
+// ----------------------------------------------------------------------------
+
+typedef void(*sha256_transform)(uint32_t state[8],
+    const uint8_t block[64]) NOEXCEPT;
+typedef void(*sha512_transform)(uint64_t state[8],
+    const uint8_t block[128]) NOEXCEPT;
+typedef void(*sha256_doubler)(uint8_t* out, const uint8_t in[]) NOEXCEPT;
+typedef void(*sha256_multiplier)(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT;
+typedef void(*message_hasher)(const uint8_t input[], size_t size,
+    uint8_t digest[]) NOEXCEPT;
+typedef void(*digests_hasher)(uint8_t out[], const uint8_t digests[],
+    size_t count) NOEXCEPT;
+typedef bool(*nonce_scanner)(uint32_t& nonce, const uint8_t header[80],
+    uint32_t first, uint32_t count, const uint8_t target[32]) NOEXCEPT;
+typedef void(*siphash_multiplier)(uint64_t out[], const uint64_t key[2],
+    const uint8_t* const in[], const size_t sizes[], size_t count) NOEXCEPT;
+
+// A paired double kernel consumes 'lanes' blocks per call.
+struct paired_stage
+{
+    size_t lanes;
+    sha256_doubler function;
+};
+
+// All hash kernels, resolved once so that hashing does not test features.
+// Paired stages are ordered widest first, with portable completing the set.
+struct dispatch_table
+{
+    kernel family;
+    sha256_transform single;
+    std::vector<paired_stage> paired;
+    sha256_multiplier multiple;
+    message_hasher ripemd160;
+    digests_hasher ripemd160_digests;
+    message_hasher sha512;
+    sha512_transform single512;
+    siphash_multiplier siphash_multiple;
+    nonce_scanner nonce_scan;
+};
+
+// Single stream candidates, in order of preference (fixed size, no allocation).
+template <typename Transform>
+struct single_candidates
+{
+    std::array<Transform, 8> items{};
+    size_t count{};
+
+    void push(Transform transform) NOEXCEPT
+    {
+        if (count < items.size())
+            items[count++] = transform;
+    }
+};
+
+// The first candidate that reproduces the portable transform is selected.
+// Selection is not timed, so the same kernel is selected on every run.
+template <typename Word, size_t Block, typename Transform>
+static Transform select_single(const single_candidates<Transform>& candidates,
+    Transform portable, const std::array<Word, 8>& initial) NOEXCEPT
+{
+    const std::array<uint8_t, Block> block{ 0x42 };
+    auto expected = initial;
+    portable(expected.data(), block.data());
+
+    for (auto index = zero; index < candidates.count; ++index)
+    {
+        auto actual = initial;
+        const auto candidate = candidates.items[index];
+        candidate(actual.data(), block.data());
+
+        if (actual == expected)
+            return candidate;
+    }
+
+    return portable;
+}
+
+// Best of several timed runs of the transform over a fixed block count.
+template <typename Word, size_t Block, typename Transform>
+static uint64_t time_single(Transform transform,
+    const std::array<Word, 8>& initial) NOEXCEPT
+{
+    constexpr auto blocks = 256_size;
+    const std::array<uint8_t, Block> block{ 0x42 };
+    auto state = initial;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto count = zero; count < blocks; ++count)
+        transform(state.data(), block.data());
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return possible_narrow_sign_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            elapsed).count());
+}
+
+// Vector single transforms (other than sha-ni) are often at parity with
+// portable, so in automatic resolution each must beat portable by at least
+// a quarter (best of interleaved trials). The margin keeps timing noise near
+// parity from changing the result, which is measured once per resolution
+// (resolutions are cached for the life of the process).
+template <typename Word, size_t Block, typename Transform>
+static bool outperforms(Transform candidate, Transform portable,
+    const std::array<Word, 8>& initial) NOEXCEPT
+{
+    constexpr auto trials = 8_size;
+    auto fastest = max_uint64;
+    auto baseline = max_uint64;
+
+    for (auto trial = zero; trial < trials; ++trial)
+    {
+        baseline = std::min(baseline,
+            time_single<Word, Block>(portable, initial));
+        fastest = std::min(fastest,
+            time_single<Word, Block>(candidate, initial));
+    }
+
+    return ceilinged_add(fastest, fastest / 4u) < baseline;
+}
+
+static bool available(kernel family) NOEXCEPT
+{
+    switch (family)
+    {
+        case kernel::automatic:
+        case kernel::portable:
+            return true;
+#ifdef WITH_SHANI
+        case kernel::shani:
+            return have_shani();
+#endif
+#ifdef WITH_AVX512
+        case kernel::avx512:
+            return have_avx512();
 #endif
 #ifdef WITH_AVX2
-    if (have_avx2())
+        case kernel::avx2:
+            return have_avx2();
+#endif
+#ifdef WITH_SSE41
+        case kernel::sse41:
+            return have_sse41();
+#endif
+#ifdef WITH_NEON
+        case kernel::neon:
+            return have_neon();
+#endif
+#ifdef WITH_SSE4
+        case kernel::sse4:
+            return have_sse4();
+#endif
+        default:
+            return false;
+    }
+}
+
+// Automatic selects all available kernels, in order of preference. Otherwise
+// only the kernels of the family are selected, with portable for the others.
+inline bool selectable(kernel family, kernel candidate) NOEXCEPT
+{
+    return (family == kernel::automatic || family == candidate) &&
+        available(candidate);
+}
+
+static dispatch_table resolve(kernel family) NOEXCEPT
+{
+    // Unless forced, sse41/avx2 single transforms must outperform portable.
+    [[maybe_unused]] const auto forced = (family != kernel::automatic);
+    [[maybe_unused]] const auto faster = [&](sha256_transform transform)
+        NOEXCEPT
     {
-        while (blocks >= 8_size)
-        {
-            double_sha256_x8_avx2(out, in);
-            std::advance(out, hash_size * 8_size);
-            std::advance(in, block_size * 8_size);
-            blocks -= 8_size;
-        }
+        return forced || outperforms<uint32_t, 64>(transform,
+            sha256_transform{ &sha256_x1_portable }, sha256_initial);
+    };
+    [[maybe_unused]] const auto faster512 = [&](sha512_transform transform)
+        NOEXCEPT
+    {
+        return forced || outperforms<uint64_t, 128>(transform,
+            sha512_transform{ &sha512_x1_portable }, sha512_initial);
+    };
+
+    single_candidates<sha256_transform> singles{};
+    single_candidates<sha512_transform> singles512{};
+
+    // Paired stages are few and allocated once for each resolution.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    dispatch_table table
+    {
+        family,
+        &sha256_x1_portable,
+        {},
+        &sha256_serial,
+        &ripemd160_portable,
+        &ripemd160_digests_portable,
+        &sha512_portable,
+        &sha512_x1_portable,
+        &siphash_serial,
+        &sha256_nonce_lanes<1, sha256_x1_lanes>
+    };
+
+#ifdef WITH_SHANI
+    if (selectable(family, kernel::shani))
+    {
+        singles.push(&sha256_x1_shani);
+        table.paired.push_back({ 2, &double_sha256_x2_shani });
+        table.paired.push_back({ 1, &double_sha256_x1_shani });
+    }
+#endif
+#ifdef WITH_AVX512
+    if (selectable(family, kernel::avx512))
+        table.paired.push_back({ 16, &double_sha256_x16_avx512 });
+#endif
+#ifdef WITH_AVX2
+    if (selectable(family, kernel::avx2))
+    {
+        if (faster(&sha256_x1_avx2))
+            singles.push(&sha256_x1_avx2);
+        if (faster512(&sha512_x1_avx2))
+            singles512.push(&sha512_x1_avx2);
+
+        table.paired.push_back({ 8, &double_sha256_x8_avx2 });
     }
 #endif
 #ifdef WITH_SSE41
-    if (have_sse41())
+    if (selectable(family, kernel::sse41))
     {
-        while (blocks >= 4_size)
-        {
-            // BUGBUG: throws on 32 bit builds.
-            double_sha256_x4_sse41(out, in);
-            std::advance(out, hash_size * 4_size);
-            std::advance(in, block_size * 4_size);
-            blocks -= 4_size;
-        }
+        // BUGBUG: throws on 32 bit builds.
+        if (faster(&sha256_x1_sse41))
+            singles.push(&sha256_x1_sse41);
+        table.paired.push_back({ 4, &double_sha256_x4_sse41 });
     }
 #endif
 #ifdef WITH_NEON
-    if (have_neon())
+    if (selectable(family, kernel::neon))
     {
-        while (blocks >= 1_size)
-        {
-            double_sha256_x1_neon(out, in);
-            std::advance(out, hash_size * 1_size);
-            std::advance(in, block_size * 1_size);
-            blocks -= 1_size;
-        }
+        singles.push(&sha256_x1_neon);
+        table.paired.push_back({ 1, &double_sha256_x1_neon });
     }
 #endif
 #ifdef WITH_SSE4
-    if (have_sse4())
+    if (selectable(family, kernel::sse4))
+    {
+        singles.push(&sha256_x1_sse4);
+        table.paired.push_back({ 1, &double_sha256_x1_sse4 });
+    }
+#endif
+
+    // Multiple is assigned in ascending order of preference (last wins).
+#ifdef WITH_SSE41
+    if (selectable(family, kernel::sse41))
+        table.multiple = &sha256_lanes<4, sha256_x4_sse41>;
+#endif
+#ifdef WITH_AVX2
+    if (selectable(family, kernel::avx2))
+        table.multiple = &sha256_lanes<8, sha256_x8_avx2>;
+#endif
+#ifdef WITH_AVX512
+    if (selectable(family, kernel::avx512))
+        table.multiple = &sha256_lanes<16, sha256_x16_avx512>;
+#endif
+#ifdef WITH_SHANI
+    if (selectable(family, kernel::shani))
+        table.multiple = &sha256_serial;
+#endif
+
+    // Ripemd160 lanes are likewise assigned in ascending order of preference.
+#ifdef WITH_SSE41
+    if (selectable(family, kernel::sse41))
+        table.ripemd160_digests = &ripemd160_digests<4, ripemd160_x4_sse41>;
+#endif
+#ifdef WITH_AVX2
+    if (selectable(family, kernel::avx2))
+        table.ripemd160_digests = &ripemd160_digests<8, ripemd160_x8_avx2>;
+#endif
+
+#ifdef WITH_AVX2
+    if (selectable(family, kernel::avx2))
+        table.siphash_multiple = &siphash_lanes<4, siphash_x4_avx2>;
+#endif
+
+    // Nonce scanning lanes are likewise assigned in ascending preference.
+#ifdef WITH_SSE41
+    if (selectable(family, kernel::sse41))
+        table.nonce_scan = &sha256_nonce_lanes<4, sha256_x4_sse41>;
+#endif
+#ifdef WITH_AVX2
+    if (selectable(family, kernel::avx2))
+        table.nonce_scan = &sha256_nonce_lanes<8, sha256_x8_avx2>;
+#endif
+#ifdef WITH_AVX512
+    if (selectable(family, kernel::avx512))
+        table.nonce_scan = &sha256_nonce_lanes<16, sha256_x16_avx512>;
+#endif
+#ifdef WITH_SHANI
+    if (selectable(family, kernel::shani))
+        table.nonce_scan = &sha256_nonce_lanes<1, sha256_x1_lanes>;
+#endif
+
+    table.single = select_single<uint32_t, 64>(singles,
+        sha256_transform{ &sha256_x1_portable }, sha256_initial);
+    table.single512 = select_single<uint64_t, 128>(singles512,
+        sha512_transform{ &sha512_x1_portable }, sha512_initial);
+    BC_POP_WARNING()
+
+    return table;
+}
+
+// BC_INTRINSICS (e.g. "portable" or "avx2") forces a family on first use.
+// An unrecognized or unavailable family is ignored (automatic).
+static kernel environment_kernel() NOEXCEPT
+{
+    BC_PUSH_WARNING(UNSAFE_CRT_FUNCTION)
+    const auto value = std::getenv("BC_INTRINSICS");
+    BC_POP_WARNING()
+
+    if (is_null(value))
+        return kernel::automatic;
+
+    const std::string name{ value };
+    const auto family =
+        name == "portable" ? kernel::portable :
+        name == "shani" ? kernel::shani :
+        name == "avx512" ? kernel::avx512 :
+        name == "avx2" ? kernel::avx2 :
+        name == "sse41" ? kernel::sse41 :
+        name == "neon" ? kernel::neon :
+        name == "sse4" ? kernel::sse4 : kernel::automatic;
+
+    return available(family) ? family : kernel::automatic;
+}
+
+// Each family is resolved once and its table is never released or modified,
+// so a table remains valid for a thread hashing while set_kernel replaces it.
+static const dispatch_table* resolved(kernel family) NOEXCEPT
+{
+    constexpr auto families = add1(static_cast<size_t>(kernel::sse4));
+    static std::array<std::optional<dispatch_table>, families> tables{};
+    static std::mutex mutex{};
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const std::lock_guard<std::mutex> lock(mutex);
+    auto& table = tables.at(static_cast<size_t>(family));
+    if (!table.has_value())
+        table.emplace(resolve(family));
+    BC_POP_WARNING()
+
+    return &table.value();
+}
+
+static std::atomic<const dispatch_table*>& current() NOEXCEPT
+{
+    static std::atomic<const dispatch_table*> table
+    {
+        resolved(environment_kernel())
+    };
+
+    return table;
+}
+
+static const dispatch_table& dispatch() NOEXCEPT
+{
+    return *current().load(std::memory_order_acquire);
+}
+
+bool set_kernel(kernel family) NOEXCEPT
+{
+    if (!available(family))
+        return false;
+
+    current().store(resolved(family), std::memory_order_release);
+    return true;
+}
+
+kernel get_kernel() NOEXCEPT
+{
+    return dispatch().family;
+}
+
+// dispatched hashes
+// ----------------------------------------------------------------------------
+
+// Iterate over contibuous blocks, with hash accumulation in 'state'. This can
+// be used to replace SHA256Transform.
+void sha256_single(uint32_t state[8], const uint8_t block[64]) NOEXCEPT
+{
+    dispatch().single(state, block);
+}
+
+// Multiple blocks are hashed independently into an array of hash values stored
+// into 'out'. This is used to reduce hash sets during merkle tree computation.
+void sha256_paired_double(uint8_t out[], const uint8_t in[],
+    size_t blocks) NOEXCEPT
+{
+    constexpr auto block_size = 64_size;
+
+    for (const auto& stage: dispatch().paired)
     {
-        while (blocks >= 1_size)
+        while (blocks >= stage.lanes)
         {
-            double_sha256_x1_sse4(out, in);
-            std::advance(out, hash_size * 1_size);
-            std::advance(in, block_size * 1_size);
-            blocks -= 1_size;
+            stage.function(out, in);
+            std::advance(out, hash_size * stage.lanes);
+            std::advance(in, block_size * stage.lanes);
+            blocks -= stage.lanes;
         }
     }
-#endif
+
     while (blocks >= 1_size)
     {
         double_sha256_x1_portable(out, in);
@@ -362,6 +1066,67 @@ void sha256_paired_double(uint8_t out[], const uint8_t in[],
     }
 }
 
+// Independent messages are hashed into an array of hash values stored into
+// 'out'. This is used to compute the transaction hashes of a block.
+void sha256_multiple(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT
+{
+    dispatch().multiple(out, in, sizes, count);
+}
+
+void ripemd160(const uint8_t input[], size_t size, uint8_t digest[20]) NOEXCEPT
+{
+    dispatch().ripemd160(input, size, digest);
+}
+
+void sha512(const uint8_t input[], size_t size, uint8_t digest[64]) NOEXCEPT
+{
+    dispatch().sha512(input, size, digest);
+}
+
+// Used by the sha512 context (and so by hmac-sha512 and pbkdf2-hmac-sha512).
+void sha512_single(uint64_t state[8], const uint8_t block[128]) NOEXCEPT
+{
+    dispatch().single512(state, block);
+}
+
+// Independent messages are hashed (sha256 then ripemd160) into an array of
+// short hashes stored into 'out'. This is used to hash sets of public keys.
+void hash160_multiple(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT
+{
+    std::vector<uint8_t> digests(count * hash_size);
+    sha256_multiple(digests.data(), in, sizes, count);
+    dispatch().ripemd160_digests(out, digests.data(), count);
+}
+
+bool sha256_nonce_scan(uint32_t& nonce, const uint8_t header[80],
+    uint32_t first, uint32_t count, const uint8_t target[32]) NOEXCEPT
+{
+    return dispatch().nonce_scan(nonce, header, first, count, target);
+}
+
+void siphash_multiple(uint64_t out[], const uint64_t key[2],
+    const uint8_t* const in[], const size_t sizes[], size_t count) NOEXCEPT
+{
+    dispatch().siphash_multiple(out, key, in, sizes, count);
+}
+
+// Each message is consumed (into its lane pad) before its digest is written,
+// so the second pass is safely performed in place.
+void double_sha256_multiple(uint8_t out[], const uint8_t* const in[],
+    const size_t sizes[], size_t count) NOEXCEPT
+{
+    sha256_multiple(out, in, sizes, count);
+
+    std::vector<const uint8_t*> digests(count);
+    const std::vector<size_t> digest_sizes(count, hash_size);
+    for (auto index = zero; index < count; ++index)
+        digests[index] = &out[index * hash_size];
+
+    sha256_multiple(out, digests.data(), digest_sizes.data(), count);
+}
+
 void double_sha256_x1_portable(uint8_t out[], const uint8_t in[1 * 64]) NOEXCEPT
 {
     constexpr auto count = 32_size / sizeof(uint32_t);
@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/define.hpp>
+
+#ifdef WITH_SSE41
+
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace libbitcoin {
+namespace system {
+namespace intrinsics {
+
+// RIPEMD160 compression of 4 independent blocks, one block per lane.
+// Message words are little endian, so no byte swap is required on load.
+
+constexpr uint32_t rmd_k_left[5]
+{
+    0x00000000ul, 0x5a827999ul, 0x6ed9eba1ul, 0x8f1bbcdcul, 0xa953fd4eul
+};
+
+constexpr uint32_t rmd_k_right[5]
+{
+    0x50a28be6ul, 0x5c4dd124ul, 0x6d703ef3ul, 0x7a6d76e9ul, 0x00000000ul
+};
+
+constexpr uint8_t rmd_r_left[80]
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+    3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+    1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+    4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13
+};
+
+constexpr uint8_t rmd_r_right[80]
+{
+    5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+    6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+    15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+    8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+    12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11
+};
+
+constexpr uint8_t rmd_s_left[80]
+{
+    11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+    7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+    11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+    11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+    9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6
+};
+
+constexpr uint8_t rmd_s_right[80]
+{
+    8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+    9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+    9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+    15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+    8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11
+};
+
+static __m128i inline K(uint32_t x) NOEXCEPT { return _mm_set1_epi32(x); }
+
+static __m128i inline Add(__m128i x, __m128i y) NOEXCEPT { return _mm_add_epi32(x, y); }
+static __m128i inline Add(__m128i x, __m128i y, __m128i z) NOEXCEPT { return Add(Add(x, y), z); }
+static __m128i inline Add(__m128i x, __m128i y, __m128i z, __m128i w) NOEXCEPT { return Add(Add(x, y), Add(z, w)); }
+static __m128i inline Xor(__m128i x, __m128i y) NOEXCEPT { return _mm_xor_si128(x, y); }
+static __m128i inline Xor(__m128i x, __m128i y, __m128i z) NOEXCEPT { return Xor(Xor(x, y), z); }
+static __m128i inline Or(__m128i x, __m128i y) NOEXCEPT { return _mm_or_si128(x, y); }
+static __m128i inline And(__m128i x, __m128i y) NOEXCEPT { return _mm_and_si128(x, y); }
+static __m128i inline Not(__m128i x) NOEXCEPT { return Xor(x, K(0xfffffffful)); }
+static __m128i inline RoL(__m128i x, int n) NOEXCEPT { return Or(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - n)); }
+
+static __m128i inline F1(__m128i x, __m128i y, __m128i z) NOEXCEPT { return Xor(x, y, z); }
+static __m128i inline F2(__m128i x, __m128i y, __m128i z) NOEXCEPT { return Or(And(x, y), And(Not(x), z)); }
+static __m128i inline F3(__m128i x, __m128i y, __m128i z) NOEXCEPT { return Xor(Or(x, Not(y)), z); }
+static __m128i inline F4(__m128i x, __m128i y, __m128i z) NOEXCEPT { return Or(And(x, z), And(y, Not(z))); }
+static __m128i inline F5(__m128i x, __m128i y, __m128i z) NOEXCEPT { return Xor(x, Or(y, Not(z))); }
+
+// The right line applies the functions in reverse order.
+static __m128i inline F(int round, __m128i x, __m128i y, __m128i z) NOEXCEPT
+{
+    switch (round)
+    {
+        case 0: return F1(x, y, z);
+        case 1: return F2(x, y, z);
+        case 2: return F3(x, y, z);
+        case 3: return F4(x, y, z);
+        default: return F5(x, y, z);
+    }
+}
+
+static void inline Step(__m128i& a, __m128i& c, __m128i e, __m128i f, __m128i x, __m128i k,
+    int s) NOEXCEPT
+{
+    a = Add(RoL(Add(a, f, x, k), s), e);
+    c = RoL(c, 10);
+}
+
+static __m128i inline Load4(uint32_t* const states[4], size_t word) NOEXCEPT
+{
+    return _mm_setr_epi32(
+        states[0][word],
+        states[1][word],
+        states[2][word],
+        states[3][word]);
+}
+
+static void inline Store4(uint32_t* const states[4], size_t word, __m128i v) NOEXCEPT
+{
+    states[0][word] = _mm_extract_epi32(v, 0);
+    states[1][word] = _mm_extract_epi32(v, 1);
+    states[2][word] = _mm_extract_epi32(v, 2);
+    states[3][word] = _mm_extract_epi32(v, 3);
+}
+
+static uint32_t inline from_little_endian(const uint8_t data[4]) NOEXCEPT
+{
+    return
+        (static_cast<uint32_t>(data[0]) << 0) |
+        (static_cast<uint32_t>(data[1]) << 8) |
+        (static_cast<uint32_t>(data[2]) << 16) |
+        (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static __m128i inline Gather4(const uint8_t* const blocks[4], int word) NOEXCEPT
+{
+    return _mm_setr_epi32(
+        from_little_endian(blocks[0] + 4 * word),
+        from_little_endian(blocks[1] + 4 * word),
+        from_little_endian(blocks[2] + 4 * word),
+        from_little_endian(blocks[3] + 4 * word));
+}
+
+// 4 independent blocks in 4 lanes, each accumulated into its lane state.
+// Lanes may be masked by the caller (scratch state and block), as there is no
+// dependency between lanes.
+void ripemd160_x4_sse41(uint32_t* const states[4],
+    const uint8_t* const blocks[4]) NOEXCEPT
+{
+    __m128i x[16];
+    for (auto word = 0; word < 16; ++word)
+        x[word] = Gather4(blocks, word);
+
+    const auto h0 = Load4(states, 0);
+    const auto h1 = Load4(states, 1);
+    const auto h2 = Load4(states, 2);
+    const auto h3 = Load4(states, 3);
+    const auto h4 = Load4(states, 4);
+
+    auto al = h0, bl = h1, cl = h2, dl = h3, el = h4;
+    auto ar = h0, br = h1, cr = h2, dr = h3, er = h4;
+
+    for (auto step = 0; step < 80; ++step)
+    {
+        const auto round = step / 16;
+        const auto kl = K(rmd_k_left[round]);
+        const auto kr = K(rmd_k_right[round]);
+
+        Step(al, cl, el, F(round, bl, cl, dl), x[rmd_r_left[step]], kl,
+            rmd_s_left[step]);
+        Step(ar, cr, er, F(4 - round, br, cr, dr), x[rmd_r_right[step]], kr,
+            rmd_s_right[step]);
+
+        // Rotate (a, b, c, d, e) to (e, a, b, c, d).
+        auto tl = el; el = dl; dl = cl; cl = bl; bl = al; al = tl;
+        auto tr = er; er = dr; dr = cr; cr = br; br = ar; ar = tr;
+    }
+
+    Store4(states, 0, Add(h1, cl, dr));
+    Store4(states, 1, Add(h2, dl, er));
+    Store4(states, 2, Add(h3, el, ar));
+    Store4(states, 3, Add(h4, al, br));
+    Store4(states, 4, Add(h0, bl, cr));
+}
+
+} // namespace intrinsics
+} // namespace system
+} // namespace libbitcoin
+
+#endif // WITH_SSE41
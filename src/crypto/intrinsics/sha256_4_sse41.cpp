@@ -101,15 +101,152 @@ void inline Write4(uint8_t* out, int offset, __m128i v) NOEXCEPT
     to_little_endian(out + 96 + offset, _mm_extract_epi32(v, 0));
 }
 
-////void sha256_sse41(uint32_t* state, const uint8_t* data, uint32_t blocks)
-void sha256_sse41(uint32_t*, const uint8_t*, uint32_t)
+// Word of each lane state (lane zero is the high element, as Read4).
+__m128i inline Load4(uint32_t* const states[4], size_t word) NOEXCEPT
 {
-    BC_ASSERT_MSG(false, "not implemented");
-    // TODO: iterate over N blocks, four lanes per block.
-    // TODO: this is currently disabled in single_sha256.
+    return _mm_set_epi32(
+        states[0][word],
+        states[1][word],
+        states[2][word],
+        states[3][word]);
 }
 
-// One block in four lanes.
+void inline Store4(uint32_t* const states[4], size_t word, __m128i v) NOEXCEPT
+{
+    states[0][word] = static_cast<uint32_t>(_mm_extract_epi32(v, 3));
+    states[1][word] = static_cast<uint32_t>(_mm_extract_epi32(v, 2));
+    states[2][word] = static_cast<uint32_t>(_mm_extract_epi32(v, 1));
+    states[3][word] = static_cast<uint32_t>(_mm_extract_epi32(v, 0));
+}
+
+// Word of each lane block, with each lane read from its own block.
+__m128i inline Gather4(const uint8_t* const blocks[4], int offset) NOEXCEPT
+{
+    __m128i ret = _mm_set_epi32(
+        from_little_endian(blocks[0] + offset),
+        from_little_endian(blocks[1] + offset),
+        from_little_endian(blocks[2] + offset),
+        from_little_endian(blocks[3] + offset));
+
+    return _mm_shuffle_epi8(ret, _mm_set_epi32(
+        0x0c0d0e0ful,
+        0x08090a0bul,
+        0x04050607ul,
+        0x00010203ul));
+}
+
+// Single stream, with the message schedule vectorized (four words per vector)
+// and the rounds performed in general purpose registers.
+// ----------------------------------------------------------------------------
+
+alignas(16) constexpr uint32_t k256[64]
+{
+    0x428a2f98ul, 0x71374491ul, 0xb5c0fbcful, 0xe9b5dba5ul,
+    0x3956c25bul, 0x59f111f1ul, 0x923f82a4ul, 0xab1c5ed5ul,
+    0xd807aa98ul, 0x12835b01ul, 0x243185beul, 0x550c7dc3ul,
+    0x72be5d74ul, 0x80deb1feul, 0x9bdc06a7ul, 0xc19bf174ul,
+    0xe49b69c1ul, 0xefbe4786ul, 0x0fc19dc6ul, 0x240ca1ccul,
+    0x2de92c6ful, 0x4a7484aaul, 0x5cb0a9dcul, 0x76f988daul,
+    0x983e5152ul, 0xa831c66dul, 0xb00327c8ul, 0xbf597fc7ul,
+    0xc6e00bf3ul, 0xd5a79147ul, 0x06ca6351ul, 0x14292967ul,
+    0x27b70a85ul, 0x2e1b2138ul, 0x4d2c6dfcul, 0x53380d13ul,
+    0x650a7354ul, 0x766a0abbul, 0x81c2c92eul, 0x92722c85ul,
+    0xa2bfe8a1ul, 0xa81a664bul, 0xc24b8b70ul, 0xc76c51a3ul,
+    0xd192e819ul, 0xd6990624ul, 0xf40e3585ul, 0x106aa070ul,
+    0x19a4c116ul, 0x1e376c08ul, 0x2748774cul, 0x34b0bcb5ul,
+    0x391c0cb3ul, 0x4ed8aa4aul, 0x5b9cca4ful, 0x682e6ff3ul,
+    0x748f82eeul, 0x78a5636ful, 0x84c87814ul, 0x8cc70208ul,
+    0x90befffaul, 0xa4506cebul, 0xbef9a3f7ul, 0xc67178f2ul
+};
+
+static uint32_t inline RoR(uint32_t x, int n) NOEXCEPT { return (x >> n) | (x << (32 - n)); }
+
+// One round of SHA-256 (scalar), with w + k precomputed.
+static void inline Round(uint32_t a, uint32_t b, uint32_t c, uint32_t& d, uint32_t e, uint32_t f, uint32_t g, uint32_t& h, uint32_t wk) NOEXCEPT
+{
+    const uint32_t t1 = h + (RoR(e, 6) ^ RoR(e, 11) ^ RoR(e, 25)) + (g ^ (e & (f ^ g))) + wk;
+    const uint32_t t2 = (RoR(a, 2) ^ RoR(a, 13) ^ RoR(a, 22)) + ((a & b) | (c & (a | b)));
+    d += t1;
+    h = t1 + t2;
+}
+
+// Sixty-four rounds over the precomputed schedule.
+static void inline Rounds(uint32_t state[8], const uint32_t wk[64]) NOEXCEPT
+{
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (auto t = 0; t < 64; t += 8)
+    {
+        Round(a, b, c, d, e, f, g, h, wk[t + 0]);
+        Round(h, a, b, c, d, e, f, g, wk[t + 1]);
+        Round(g, h, a, b, c, d, e, f, wk[t + 2]);
+        Round(f, g, h, a, b, c, d, e, wk[t + 3]);
+        Round(e, f, g, h, a, b, c, d, wk[t + 4]);
+        Round(d, e, f, g, h, a, b, c, wk[t + 5]);
+        Round(c, d, e, f, g, h, a, b, wk[t + 6]);
+        Round(b, c, d, e, f, g, h, a, wk[t + 7]);
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// Big-endian load of four message words.
+__m128i inline Load(const uint8_t* data) NOEXCEPT
+{
+    const auto mask = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), mask);
+}
+
+// Next four schedule words (w[t..t+3]) from the prior sixteen (x0..x3).
+__m128i inline Schedule(__m128i x0, __m128i x1, __m128i x2, __m128i x3) NOEXCEPT
+{
+    const auto w15 = _mm_alignr_epi8(x1, x0, 4);
+    const auto w7 = _mm_alignr_epi8(x3, x2, 4);
+    const auto w = Add(x0, sigma0(w15), w7, sigma1(_mm_srli_si128(x3, 8)));
+    return Add(w, sigma1(_mm_slli_si128(w, 8)));
+}
+
+// Store w + k for four schedule words.
+void inline Store(uint32_t wk[64], int t, __m128i w) NOEXCEPT
+{
+    const auto k = _mm_load_si128((const __m128i*)&k256[t]);
+    _mm_store_si128((__m128i*)&wk[t], Add(w, k));
+}
+
+void sha256_sse41(uint32_t* state, const uint8_t* data, uint32_t blocks) NOEXCEPT
+{
+    alignas(16) uint32_t wk[64];
+
+    for (; blocks > 0; --blocks, data += 64)
+    {
+        auto x0 = Load(data + 0);
+        auto x1 = Load(data + 16);
+        auto x2 = Load(data + 32);
+        auto x3 = Load(data + 48);
+
+        for (auto t = 0; t < 64; t += 16)
+        {
+            Store(wk, t + 0, x0);
+            Store(wk, t + 4, x1);
+            Store(wk, t + 8, x2);
+            Store(wk, t + 12, x3);
+
+            if (t < 48)
+            {
+                x0 = Schedule(x0, x1, x2, x3);
+                x1 = Schedule(x1, x2, x3, x0);
+                x2 = Schedule(x2, x3, x0, x1);
+                x3 = Schedule(x3, x0, x1, x2);
+            }
+        }
+
+        Rounds(state, wk);
+    }
+}
+
+// One block, schedule in four lanes.
 void sha256_x1_sse41(uint32_t state[8], const uint8_t block[64]) NOEXCEPT
 {
     return sha256_sse41(state, block, 1);
@@ -125,6 +262,99 @@ void sha256_x1_sse41(uint32_t state[8], const uint8_t block[64]) NOEXCEPT
 ////    // TODO: one block in four lanes, doubled.
 ////}
 
+// Four independent blocks in four lanes, each accumulated into its lane state.
+// Lanes may be masked by the caller (scratch state and block), as there is no
+// dependency between lanes.
+void sha256_x4_sse41(uint32_t* const states[4],
+    const uint8_t* const blocks[4]) NOEXCEPT
+{
+    __m128i a = Load4(states, 0);
+    __m128i b = Load4(states, 1);
+    __m128i c = Load4(states, 2);
+    __m128i d = Load4(states, 3);
+    __m128i e = Load4(states, 4);
+    __m128i f = Load4(states, 5);
+    __m128i g = Load4(states, 6);
+    __m128i h = Load4(states, 7);
+
+    const __m128i t0 = a, t1 = b, t2 = c, t3 = d, t4 = e, t5 = f, t6 = g, t7 = h;
+    __m128i w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15;
+
+    Round(a, b, c, d, e, f, g, h, Add(K(0x428a2f98ul), w0 = Gather4(blocks, 0)));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x71374491ul), w1 = Gather4(blocks, 4)));
+    Round(g, h, a, b, c, d, e, f, Add(K(0xb5c0fbcful), w2 = Gather4(blocks, 8)));
+    Round(f, g, h, a, b, c, d, e, Add(K(0xe9b5dba5ul), w3 = Gather4(blocks, 12)));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x3956c25bul), w4 = Gather4(blocks, 16)));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x59f111f1ul), w5 = Gather4(blocks, 20)));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x923f82a4ul), w6 = Gather4(blocks, 24)));
+    Round(b, c, d, e, f, g, h, a, Add(K(0xab1c5ed5ul), w7 = Gather4(blocks, 28)));
+    Round(a, b, c, d, e, f, g, h, Add(K(0xd807aa98ul), w8 = Gather4(blocks, 32)));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x12835b01ul), w9 = Gather4(blocks, 36)));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x243185beul), w10 = Gather4(blocks, 40)));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x550c7dc3ul), w11 = Gather4(blocks, 44)));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x72be5d74ul), w12 = Gather4(blocks, 48)));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x80deb1feul), w13 = Gather4(blocks, 52)));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x9bdc06a7ul), w14 = Gather4(blocks, 56)));
+    Round(b, c, d, e, f, g, h, a, Add(K(0xc19bf174ul), w15 = Gather4(blocks, 60)));
+    Round(a, b, c, d, e, f, g, h, Add(K(0xe49b69c1ul), Inc(w0, sigma1(w14), w9, sigma0(w1))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0xefbe4786ul), Inc(w1, sigma1(w15), w10, sigma0(w2))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x0fc19dc6ul), Inc(w2, sigma1(w0), w11, sigma0(w3))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x240ca1ccul), Inc(w3, sigma1(w1), w12, sigma0(w4))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x2de92c6ful), Inc(w4, sigma1(w2), w13, sigma0(w5))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x4a7484aaul), Inc(w5, sigma1(w3), w14, sigma0(w6))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x5cb0a9dcul), Inc(w6, sigma1(w4), w15, sigma0(w7))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x76f988daul), Inc(w7, sigma1(w5), w0, sigma0(w8))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x983e5152ul), Inc(w8, sigma1(w6), w1, sigma0(w9))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0xa831c66dul), Inc(w9, sigma1(w7), w2, sigma0(w10))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0xb00327c8ul), Inc(w10, sigma1(w8), w3, sigma0(w11))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0xbf597fc7ul), Inc(w11, sigma1(w9), w4, sigma0(w12))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0xc6e00bf3ul), Inc(w12, sigma1(w10), w5, sigma0(w13))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0xd5a79147ul), Inc(w13, sigma1(w11), w6, sigma0(w14))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x06ca6351ul), Inc(w14, sigma1(w12), w7, sigma0(w15))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x14292967ul), Inc(w15, sigma1(w13), w8, sigma0(w0))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x27b70a85ul), Inc(w0, sigma1(w14), w9, sigma0(w1))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x2e1b2138ul), Inc(w1, sigma1(w15), w10, sigma0(w2))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x4d2c6dfcul), Inc(w2, sigma1(w0), w11, sigma0(w3))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x53380d13ul), Inc(w3, sigma1(w1), w12, sigma0(w4))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x650a7354ul), Inc(w4, sigma1(w2), w13, sigma0(w5))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x766a0abbul), Inc(w5, sigma1(w3), w14, sigma0(w6))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x81c2c92eul), Inc(w6, sigma1(w4), w15, sigma0(w7))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x92722c85ul), Inc(w7, sigma1(w5), w0, sigma0(w8))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0xa2bfe8a1ul), Inc(w8, sigma1(w6), w1, sigma0(w9))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0xa81a664bul), Inc(w9, sigma1(w7), w2, sigma0(w10))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0xc24b8b70ul), Inc(w10, sigma1(w8), w3, sigma0(w11))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0xc76c51a3ul), Inc(w11, sigma1(w9), w4, sigma0(w12))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0xd192e819ul), Inc(w12, sigma1(w10), w5, sigma0(w13))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0xd6990624ul), Inc(w13, sigma1(w11), w6, sigma0(w14))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0xf40e3585ul), Inc(w14, sigma1(w12), w7, sigma0(w15))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x106aa070ul), Inc(w15, sigma1(w13), w8, sigma0(w0))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x19a4c116ul), Inc(w0, sigma1(w14), w9, sigma0(w1))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x1e376c08ul), Inc(w1, sigma1(w15), w10, sigma0(w2))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x2748774cul), Inc(w2, sigma1(w0), w11, sigma0(w3))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x34b0bcb5ul), Inc(w3, sigma1(w1), w12, sigma0(w4))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x391c0cb3ul), Inc(w4, sigma1(w2), w13, sigma0(w5))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x4ed8aa4aul), Inc(w5, sigma1(w3), w14, sigma0(w6))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x5b9cca4ful), Inc(w6, sigma1(w4), w15, sigma0(w7))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x682e6ff3ul), Inc(w7, sigma1(w5), w0, sigma0(w8))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x748f82eeul), Inc(w8, sigma1(w6), w1, sigma0(w9))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x78a5636ful), Inc(w9, sigma1(w7), w2, sigma0(w10))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x84c87814ul), Inc(w10, sigma1(w8), w3, sigma0(w11))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x8cc70208ul), Inc(w11, sigma1(w9), w4, sigma0(w12))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x90befffaul), Inc(w12, sigma1(w10), w5, sigma0(w13))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0xa4506cebul), Inc(w13, sigma1(w11), w6, sigma0(w14))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0xbef9a3f7ul), Inc(w14, sigma1(w12), w7, sigma0(w15))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0xc67178f2ul), Inc(w15, sigma1(w13), w8, sigma0(w0))));
+
+    Store4(states, 0, Add(a, t0));
+    Store4(states, 1, Add(b, t1));
+    Store4(states, 2, Add(c, t2));
+    Store4(states, 3, Add(d, t3));
+    Store4(states, 4, Add(e, t4));
+    Store4(states, 5, Add(f, t5));
+    Store4(states, 6, Add(g, t6));
+    Store4(states, 7, Add(h, t7));
+}
+
 // four blocks in four lanes, doubled.
 void double_sha256_x4_sse41(uint8_t* out, const uint8_t in[4 * 64]) NOEXCEPT
 {
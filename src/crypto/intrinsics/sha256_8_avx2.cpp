@@ -110,15 +110,193 @@ void inline Write8(uint8_t* out, int offset, __m256i v) NOEXCEPT
     to_little_endian(out + 224 + offset, _mm256_extract_epi32(v, 0));
 }
 
-////void sha256_avx2(uint32_t* state, const uint8_t* data, uint32_t blocks)
-void sha256_avx2(uint32_t*, const uint8_t*, uint32_t)
+// Word of each lane state (lane zero is the high element, as Read8).
+__m256i inline Load8(uint32_t* const states[8], size_t word) NOEXCEPT
 {
-    BC_ASSERT_MSG(false, "not implemented");
-    // TODO: iterate over N blocks, eight lanes per block.
-    // TODO: this is currently disabled in single_sha256.
+    return _mm256_set_epi32(
+        states[0][word],
+        states[1][word],
+        states[2][word],
+        states[3][word],
+        states[4][word],
+        states[5][word],
+        states[6][word],
+        states[7][word]);
 }
 
-// One block in eight lanes.
+void inline Store8(uint32_t* const states[8], size_t word, __m256i v) NOEXCEPT
+{
+    states[0][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 7));
+    states[1][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 6));
+    states[2][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 5));
+    states[3][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 4));
+    states[4][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 3));
+    states[5][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 2));
+    states[6][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 1));
+    states[7][word] = static_cast<uint32_t>(_mm256_extract_epi32(v, 0));
+}
+
+// Word of each lane block, with each lane read from its own block.
+__m256i inline Gather8(const uint8_t* const blocks[8], int offset) NOEXCEPT
+{
+    __m256i ret = _mm256_set_epi32(
+        from_little_endian(blocks[0] + offset),
+        from_little_endian(blocks[1] + offset),
+        from_little_endian(blocks[2] + offset),
+        from_little_endian(blocks[3] + offset),
+        from_little_endian(blocks[4] + offset),
+        from_little_endian(blocks[5] + offset),
+        from_little_endian(blocks[6] + offset),
+        from_little_endian(blocks[7] + offset));
+
+    return _mm256_shuffle_epi8(ret, _mm256_set_epi32(
+        0x0c0d0e0ful,
+        0x08090a0bul,
+        0x04050607ul,
+        0x00010203ul,
+        0x0c0d0e0ful,
+        0x08090a0bul,
+        0x04050607ul,
+        0x00010203ul));
+}
+
+// Single stream, with the message schedules of two consecutive blocks
+// vectorized together (four words of each block per vector) and the rounds
+// performed in general purpose registers.
+// ----------------------------------------------------------------------------
+
+alignas(16) constexpr uint32_t k256[64]
+{
+    0x428a2f98ul, 0x71374491ul, 0xb5c0fbcful, 0xe9b5dba5ul,
+    0x3956c25bul, 0x59f111f1ul, 0x923f82a4ul, 0xab1c5ed5ul,
+    0xd807aa98ul, 0x12835b01ul, 0x243185beul, 0x550c7dc3ul,
+    0x72be5d74ul, 0x80deb1feul, 0x9bdc06a7ul, 0xc19bf174ul,
+    0xe49b69c1ul, 0xefbe4786ul, 0x0fc19dc6ul, 0x240ca1ccul,
+    0x2de92c6ful, 0x4a7484aaul, 0x5cb0a9dcul, 0x76f988daul,
+    0x983e5152ul, 0xa831c66dul, 0xb00327c8ul, 0xbf597fc7ul,
+    0xc6e00bf3ul, 0xd5a79147ul, 0x06ca6351ul, 0x14292967ul,
+    0x27b70a85ul, 0x2e1b2138ul, 0x4d2c6dfcul, 0x53380d13ul,
+    0x650a7354ul, 0x766a0abbul, 0x81c2c92eul, 0x92722c85ul,
+    0xa2bfe8a1ul, 0xa81a664bul, 0xc24b8b70ul, 0xc76c51a3ul,
+    0xd192e819ul, 0xd6990624ul, 0xf40e3585ul, 0x106aa070ul,
+    0x19a4c116ul, 0x1e376c08ul, 0x2748774cul, 0x34b0bcb5ul,
+    0x391c0cb3ul, 0x4ed8aa4aul, 0x5b9cca4ful, 0x682e6ff3ul,
+    0x748f82eeul, 0x78a5636ful, 0x84c87814ul, 0x8cc70208ul,
+    0x90befffaul, 0xa4506cebul, 0xbef9a3f7ul, 0xc67178f2ul
+};
+
+static uint32_t inline RoR(uint32_t x, int n) NOEXCEPT { return (x >> n) | (x << (32 - n)); }
+
+// One round of SHA-256 (scalar), with w + k precomputed.
+static void inline Round(uint32_t a, uint32_t b, uint32_t c, uint32_t& d, uint32_t e, uint32_t f, uint32_t g, uint32_t& h, uint32_t wk) NOEXCEPT
+{
+    const uint32_t t1 = h + (RoR(e, 6) ^ RoR(e, 11) ^ RoR(e, 25)) + (g ^ (e & (f ^ g))) + wk;
+    const uint32_t t2 = (RoR(a, 2) ^ RoR(a, 13) ^ RoR(a, 22)) + ((a & b) | (c & (a | b)));
+    d += t1;
+    h = t1 + t2;
+}
+
+// Sixty-four rounds over the precomputed schedule.
+static void inline Rounds(uint32_t state[8], const uint32_t wk[64]) NOEXCEPT
+{
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (auto t = 0; t < 64; t += 8)
+    {
+        Round(a, b, c, d, e, f, g, h, wk[t + 0]);
+        Round(h, a, b, c, d, e, f, g, wk[t + 1]);
+        Round(g, h, a, b, c, d, e, f, wk[t + 2]);
+        Round(f, g, h, a, b, c, d, e, wk[t + 3]);
+        Round(e, f, g, h, a, b, c, d, wk[t + 4]);
+        Round(d, e, f, g, h, a, b, c, wk[t + 5]);
+        Round(c, d, e, f, g, h, a, b, wk[t + 6]);
+        Round(b, c, d, e, f, g, h, a, wk[t + 7]);
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// Big-endian load of four message words from each of two blocks.
+__m256i inline Load(const uint8_t* first, const uint8_t* second) NOEXCEPT
+{
+    const auto mask = _mm256_set_epi64x(
+        0x0c0d0e0f08090a0bull, 0x0405060700010203ull,
+        0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+
+    return _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+        _mm_loadu_si128((const __m128i*)first)),
+        _mm_loadu_si128((const __m128i*)second), 1), mask);
+}
+
+// Next four schedule words (w[t..t+3]) of each block from the prior sixteen.
+// All byte shifts and alignments operate within each 128 bit (block) lane.
+__m256i inline Schedule(__m256i x0, __m256i x1, __m256i x2, __m256i x3) NOEXCEPT
+{
+    const auto w15 = _mm256_alignr_epi8(x1, x0, 4);
+    const auto w7 = _mm256_alignr_epi8(x3, x2, 4);
+    const auto w = Add(x0, sigma0(w15), w7, sigma1(_mm256_srli_si256(x3, 8)));
+    return Add(w, sigma1(_mm256_slli_si256(w, 8)));
+}
+
+// Store w + k for four schedule words of each block.
+void inline Store(uint32_t first[64], uint32_t second[64], int t,
+    __m256i w) NOEXCEPT
+{
+    const auto k = _mm256_broadcastsi128_si256(
+        _mm_load_si128((const __m128i*)&k256[t]));
+
+    const auto wk = Add(w, k);
+    _mm_store_si128((__m128i*)&first[t], _mm256_castsi256_si128(wk));
+    _mm_store_si128((__m128i*)&second[t], _mm256_extracti128_si256(wk, 1));
+}
+
+void sha256_avx2(uint32_t* state, const uint8_t* data, uint32_t blocks) NOEXCEPT
+{
+    alignas(32) uint32_t first[64];
+    alignas(32) uint32_t second[64];
+
+    while (blocks > 0)
+    {
+        // An odd final block is scheduled in both lanes, the second ignored.
+        const auto pair = blocks > 1;
+        const auto next = pair ? data + 64 : data;
+
+        auto x0 = Load(data + 0, next + 0);
+        auto x1 = Load(data + 16, next + 16);
+        auto x2 = Load(data + 32, next + 32);
+        auto x3 = Load(data + 48, next + 48);
+
+        for (auto t = 0; t < 64; t += 16)
+        {
+            Store(first, second, t + 0, x0);
+            Store(first, second, t + 4, x1);
+            Store(first, second, t + 8, x2);
+            Store(first, second, t + 12, x3);
+
+            if (t < 48)
+            {
+                x0 = Schedule(x0, x1, x2, x3);
+                x1 = Schedule(x1, x2, x3, x0);
+                x2 = Schedule(x2, x3, x0, x1);
+                x3 = Schedule(x3, x0, x1, x2);
+            }
+        }
+
+        // Rounds are serially dependent across blocks.
+        Rounds(state, first);
+
+        if (pair)
+            Rounds(state, second);
+
+        const auto consumed = pair ? 2u : 1u;
+        data += consumed * 64;
+        blocks -= consumed;
+    }
+}
+
+// One block, schedule in four lanes.
 void sha256_x1_avx2(uint32_t state[8], const uint8_t block[64]) NOEXCEPT
 {
     return sha256_avx2(state, block, 1);
@@ -134,6 +312,99 @@ void sha256_x1_avx2(uint32_t state[8], const uint8_t block[64]) NOEXCEPT
 ////    // TODO: one block in eight lanes, doubled.
 ////}
 
+// Eight independent blocks in eight lanes, each accumulated into its lane state.
+// Lanes may be masked by the caller (scratch state and block), as there is no
+// dependency between lanes.
+void sha256_x8_avx2(uint32_t* const states[8],
+    const uint8_t* const blocks[8]) NOEXCEPT
+{
+    __m256i a = Load8(states, 0);
+    __m256i b = Load8(states, 1);
+    __m256i c = Load8(states, 2);
+    __m256i d = Load8(states, 3);
+    __m256i e = Load8(states, 4);
+    __m256i f = Load8(states, 5);
+    __m256i g = Load8(states, 6);
+    __m256i h = Load8(states, 7);
+
+    const __m256i t0 = a, t1 = b, t2 = c, t3 = d, t4 = e, t5 = f, t6 = g, t7 = h;
+    __m256i w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10, w11, w12, w13, w14, w15;
+
+    Round(a, b, c, d, e, f, g, h, Add(K(0x428a2f98ul), w0 = Gather8(blocks, 0)));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x71374491ul), w1 = Gather8(blocks, 4)));
+    Round(g, h, a, b, c, d, e, f, Add(K(0xb5c0fbcful), w2 = Gather8(blocks, 8)));
+    Round(f, g, h, a, b, c, d, e, Add(K(0xe9b5dba5ul), w3 = Gather8(blocks, 12)));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x3956c25bul), w4 = Gather8(blocks, 16)));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x59f111f1ul), w5 = Gather8(blocks, 20)));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x923f82a4ul), w6 = Gather8(blocks, 24)));
+    Round(b, c, d, e, f, g, h, a, Add(K(0xab1c5ed5ul), w7 = Gather8(blocks, 28)));
+    Round(a, b, c, d, e, f, g, h, Add(K(0xd807aa98ul), w8 = Gather8(blocks, 32)));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x12835b01ul), w9 = Gather8(blocks, 36)));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x243185beul), w10 = Gather8(blocks, 40)));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x550c7dc3ul), w11 = Gather8(blocks, 44)));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x72be5d74ul), w12 = Gather8(blocks, 48)));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x80deb1feul), w13 = Gather8(blocks, 52)));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x9bdc06a7ul), w14 = Gather8(blocks, 56)));
+    Round(b, c, d, e, f, g, h, a, Add(K(0xc19bf174ul), w15 = Gather8(blocks, 60)));
+    Round(a, b, c, d, e, f, g, h, Add(K(0xe49b69c1ul), Inc(w0, sigma1(w14), w9, sigma0(w1))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0xefbe4786ul), Inc(w1, sigma1(w15), w10, sigma0(w2))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x0fc19dc6ul), Inc(w2, sigma1(w0), w11, sigma0(w3))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x240ca1ccul), Inc(w3, sigma1(w1), w12, sigma0(w4))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x2de92c6ful), Inc(w4, sigma1(w2), w13, sigma0(w5))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x4a7484aaul), Inc(w5, sigma1(w3), w14, sigma0(w6))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x5cb0a9dcul), Inc(w6, sigma1(w4), w15, sigma0(w7))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x76f988daul), Inc(w7, sigma1(w5), w0, sigma0(w8))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x983e5152ul), Inc(w8, sigma1(w6), w1, sigma0(w9))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0xa831c66dul), Inc(w9, sigma1(w7), w2, sigma0(w10))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0xb00327c8ul), Inc(w10, sigma1(w8), w3, sigma0(w11))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0xbf597fc7ul), Inc(w11, sigma1(w9), w4, sigma0(w12))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0xc6e00bf3ul), Inc(w12, sigma1(w10), w5, sigma0(w13))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0xd5a79147ul), Inc(w13, sigma1(w11), w6, sigma0(w14))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x06ca6351ul), Inc(w14, sigma1(w12), w7, sigma0(w15))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x14292967ul), Inc(w15, sigma1(w13), w8, sigma0(w0))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x27b70a85ul), Inc(w0, sigma1(w14), w9, sigma0(w1))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x2e1b2138ul), Inc(w1, sigma1(w15), w10, sigma0(w2))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x4d2c6dfcul), Inc(w2, sigma1(w0), w11, sigma0(w3))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x53380d13ul), Inc(w3, sigma1(w1), w12, sigma0(w4))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x650a7354ul), Inc(w4, sigma1(w2), w13, sigma0(w5))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x766a0abbul), Inc(w5, sigma1(w3), w14, sigma0(w6))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x81c2c92eul), Inc(w6, sigma1(w4), w15, sigma0(w7))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x92722c85ul), Inc(w7, sigma1(w5), w0, sigma0(w8))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0xa2bfe8a1ul), Inc(w8, sigma1(w6), w1, sigma0(w9))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0xa81a664bul), Inc(w9, sigma1(w7), w2, sigma0(w10))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0xc24b8b70ul), Inc(w10, sigma1(w8), w3, sigma0(w11))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0xc76c51a3ul), Inc(w11, sigma1(w9), w4, sigma0(w12))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0xd192e819ul), Inc(w12, sigma1(w10), w5, sigma0(w13))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0xd6990624ul), Inc(w13, sigma1(w11), w6, sigma0(w14))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0xf40e3585ul), Inc(w14, sigma1(w12), w7, sigma0(w15))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x106aa070ul), Inc(w15, sigma1(w13), w8, sigma0(w0))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x19a4c116ul), Inc(w0, sigma1(w14), w9, sigma0(w1))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x1e376c08ul), Inc(w1, sigma1(w15), w10, sigma0(w2))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x2748774cul), Inc(w2, sigma1(w0), w11, sigma0(w3))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x34b0bcb5ul), Inc(w3, sigma1(w1), w12, sigma0(w4))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x391c0cb3ul), Inc(w4, sigma1(w2), w13, sigma0(w5))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0x4ed8aa4aul), Inc(w5, sigma1(w3), w14, sigma0(w6))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0x5b9cca4ful), Inc(w6, sigma1(w4), w15, sigma0(w7))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0x682e6ff3ul), Inc(w7, sigma1(w5), w0, sigma0(w8))));
+    Round(a, b, c, d, e, f, g, h, Add(K(0x748f82eeul), Inc(w8, sigma1(w6), w1, sigma0(w9))));
+    Round(h, a, b, c, d, e, f, g, Add(K(0x78a5636ful), Inc(w9, sigma1(w7), w2, sigma0(w10))));
+    Round(g, h, a, b, c, d, e, f, Add(K(0x84c87814ul), Inc(w10, sigma1(w8), w3, sigma0(w11))));
+    Round(f, g, h, a, b, c, d, e, Add(K(0x8cc70208ul), Inc(w11, sigma1(w9), w4, sigma0(w12))));
+    Round(e, f, g, h, a, b, c, d, Add(K(0x90befffaul), Inc(w12, sigma1(w10), w5, sigma0(w13))));
+    Round(d, e, f, g, h, a, b, c, Add(K(0xa4506cebul), Inc(w13, sigma1(w11), w6, sigma0(w14))));
+    Round(c, d, e, f, g, h, a, b, Add(K(0xbef9a3f7ul), Inc(w14, sigma1(w12), w7, sigma0(w15))));
+    Round(b, c, d, e, f, g, h, a, Add(K(0xc67178f2ul), Inc(w15, sigma1(w13), w8, sigma0(w0))));
+
+    Store8(states, 0, Add(a, t0));
+    Store8(states, 1, Add(b, t1));
+    Store8(states, 2, Add(c, t2));
+    Store8(states, 3, Add(d, t3));
+    Store8(states, 4, Add(e, t4));
+    Store8(states, 5, Add(f, t5));
+    Store8(states, 6, Add(g, t6));
+    Store8(states, 7, Add(h, t7));
+}
+
 // eight blocks in eight lanes, doubled.
 void double_sha256_x8_avx2(uint8_t* out, const uint8_t in[8 * 64]) NOEXCEPT
 {
@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/define.hpp>
+
+#ifdef WITH_AVX2
+
+#include <stdint.h>
+#include <immintrin.h>
+
+namespace libbitcoin {
+namespace system {
+namespace intrinsics {
+
+// Single stream SHA512, with the message schedules of two consecutive blocks
+// vectorized together (two words of each block per 128 bit lane) and the
+// rounds performed in general purpose registers. Each pair of schedule words
+// depends only on prior pairs, so no intra-vector dependency arises.
+
+alignas(32) constexpr uint64_t k512[80]
+{
+    0x428a2f98d728ae22ull, 0x7137449123ef65cdull, 0xb5c0fbcfec4d3b2full,
+    0xe9b5dba58189dbbcull, 0x3956c25bf348b538ull, 0x59f111f1b605d019ull,
+    0x923f82a4af194f9bull, 0xab1c5ed5da6d8118ull, 0xd807aa98a3030242ull,
+    0x12835b0145706fbeull, 0x243185be4ee4b28cull, 0x550c7dc3d5ffb4e2ull,
+    0x72be5d74f27b896full, 0x80deb1fe3b1696b1ull, 0x9bdc06a725c71235ull,
+    0xc19bf174cf692694ull, 0xe49b69c19ef14ad2ull, 0xefbe4786384f25e3ull,
+    0x0fc19dc68b8cd5b5ull, 0x240ca1cc77ac9c65ull, 0x2de92c6f592b0275ull,
+    0x4a7484aa6ea6e483ull, 0x5cb0a9dcbd41fbd4ull, 0x76f988da831153b5ull,
+    0x983e5152ee66dfabull, 0xa831c66d2db43210ull, 0xb00327c898fb213full,
+    0xbf597fc7beef0ee4ull, 0xc6e00bf33da88fc2ull, 0xd5a79147930aa725ull,
+    0x06ca6351e003826full, 0x142929670a0e6e70ull, 0x27b70a8546d22ffcull,
+    0x2e1b21385c26c926ull, 0x4d2c6dfc5ac42aedull, 0x53380d139d95b3dfull,
+    0x650a73548baf63deull, 0x766a0abb3c77b2a8ull, 0x81c2c92e47edaee6ull,
+    0x92722c851482353bull, 0xa2bfe8a14cf10364ull, 0xa81a664bbc423001ull,
+    0xc24b8b70d0f89791ull, 0xc76c51a30654be30ull, 0xd192e819d6ef5218ull,
+    0xd69906245565a910ull, 0xf40e35855771202aull, 0x106aa07032bbd1b8ull,
+    0x19a4c116b8d2d0c8ull, 0x1e376c085141ab53ull, 0x2748774cdf8eeb99ull,
+    0x34b0bcb5e19b48a8ull, 0x391c0cb3c5c95a63ull, 0x4ed8aa4ae3418acbull,
+    0x5b9cca4f7763e373ull, 0x682e6ff3d6b2b8a3ull, 0x748f82ee5defb2fcull,
+    0x78a5636f43172f60ull, 0x84c87814a1f0ab72ull, 0x8cc702081a6439ecull,
+    0x90befffa23631e28ull, 0xa4506cebde82bde9ull, 0xbef9a3f7b2c67915ull,
+    0xc67178f2e372532bull, 0xca273eceea26619cull, 0xd186b8c721c0c207ull,
+    0xeada7dd6cde0eb1eull, 0xf57d4f7fee6ed178ull, 0x06f067aa72176fbaull,
+    0x0a637dc5a2c898a6ull, 0x113f9804bef90daeull, 0x1b710b35131c471bull,
+    0x28db77f523047d84ull, 0x32caab7b40c72493ull, 0x3c9ebe0a15c9bebcull,
+    0x431d67c49c100d4cull, 0x4cc5d4becb3e42b6ull, 0x597f299cfc657e2aull,
+    0x5fcb6fab3ad6faecull, 0x6c44198c4a475817ull
+};
+
+static __m256i inline Add(__m256i x, __m256i y) NOEXCEPT { return _mm256_add_epi64(x, y); }
+static __m256i inline Add(__m256i x, __m256i y, __m256i z, __m256i w) NOEXCEPT { return Add(Add(x, y), Add(z, w)); }
+static __m256i inline Xor(__m256i x, __m256i y, __m256i z) NOEXCEPT { return _mm256_xor_si256(_mm256_xor_si256(x, y), z); }
+static __m256i inline ShR(__m256i x, int n) NOEXCEPT { return _mm256_srli_epi64(x, n); }
+static __m256i inline RoR(__m256i x, int n) NOEXCEPT { return _mm256_or_si256(ShR(x, n), _mm256_slli_epi64(x, 64 - n)); }
+static __m256i inline sigma0(__m256i x) NOEXCEPT { return Xor(RoR(x, 1), RoR(x, 8), ShR(x, 7)); }
+static __m256i inline sigma1(__m256i x) NOEXCEPT { return Xor(RoR(x, 19), RoR(x, 61), ShR(x, 6)); }
+
+static uint64_t inline RoR(uint64_t x, int n) NOEXCEPT { return (x >> n) | (x << (64 - n)); }
+
+// One round of SHA-512 (scalar), with w + k precomputed.
+static void inline Round(uint64_t a, uint64_t b, uint64_t c, uint64_t& d, uint64_t e, uint64_t f, uint64_t g, uint64_t& h, uint64_t wk) NOEXCEPT
+{
+    const uint64_t t1 = h + (RoR(e, 14) ^ RoR(e, 18) ^ RoR(e, 41)) + (g ^ (e & (f ^ g))) + wk;
+    const uint64_t t2 = (RoR(a, 28) ^ RoR(a, 34) ^ RoR(a, 39)) + ((a & b) | (c & (a | b)));
+    d += t1;
+    h = t1 + t2;
+}
+
+// Eighty rounds over the precomputed schedule.
+static void inline Rounds(uint64_t state[8], const uint64_t wk[80]) NOEXCEPT
+{
+    uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (auto t = 0; t < 80; t += 8)
+    {
+        Round(a, b, c, d, e, f, g, h, wk[t + 0]);
+        Round(h, a, b, c, d, e, f, g, wk[t + 1]);
+        Round(g, h, a, b, c, d, e, f, wk[t + 2]);
+        Round(f, g, h, a, b, c, d, e, wk[t + 3]);
+        Round(e, f, g, h, a, b, c, d, wk[t + 4]);
+        Round(d, e, f, g, h, a, b, c, wk[t + 5]);
+        Round(c, d, e, f, g, h, a, b, wk[t + 6]);
+        Round(b, c, d, e, f, g, h, a, wk[t + 7]);
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// Big-endian load of two message words from each of two blocks.
+static __m256i inline Load(const uint8_t* first, const uint8_t* second) NOEXCEPT
+{
+    const auto mask = _mm256_set_epi64x(
+        0x08090a0b0c0d0e0full, 0x0001020304050607ull,
+        0x08090a0b0c0d0e0full, 0x0001020304050607ull);
+
+    return _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(
+        _mm_loadu_si128((const __m128i*)first)),
+        _mm_loadu_si128((const __m128i*)second), 1), mask);
+}
+
+// Next two schedule words (w[t..t+1]) of each block, from the pairs holding
+// w[t-16..t-15], w[t-14..t-13], w[t-8..t-7], w[t-6..t-5] and w[t-2..t-1].
+static __m256i inline Schedule(__m256i x0, __m256i x1, __m256i x4, __m256i x5,
+    __m256i x7) NOEXCEPT
+{
+    const auto w15 = _mm256_alignr_epi8(x1, x0, 8);
+    const auto w7 = _mm256_alignr_epi8(x5, x4, 8);
+    return Add(x0, sigma0(w15), w7, sigma1(x7));
+}
+
+// Store w + k for two schedule words of each block.
+static void inline Store(uint64_t first[80], uint64_t second[80], int t,
+    __m256i w) NOEXCEPT
+{
+    const auto k = _mm256_broadcastsi128_si256(
+        _mm_load_si128((const __m128i*)&k512[t]));
+
+    const auto wk = Add(w, k);
+    _mm_store_si128((__m128i*)&first[t], _mm256_castsi256_si128(wk));
+    _mm_store_si128((__m128i*)&second[t], _mm256_extracti128_si256(wk, 1));
+}
+
+void sha512_avx2(uint64_t* state, const uint8_t* data, uint32_t blocks) NOEXCEPT
+{
+    alignas(32) uint64_t first[80];
+    alignas(32) uint64_t second[80];
+
+    while (blocks > 0)
+    {
+        // An odd final block is scheduled in both lanes, the second ignored.
+        const auto pair = blocks > 1;
+        const auto next = pair ? data + 128 : data;
+
+        auto x0 = Load(data + 0, next + 0);
+        auto x1 = Load(data + 16, next + 16);
+        auto x2 = Load(data + 32, next + 32);
+        auto x3 = Load(data + 48, next + 48);
+        auto x4 = Load(data + 64, next + 64);
+        auto x5 = Load(data + 80, next + 80);
+        auto x6 = Load(data + 96, next + 96);
+        auto x7 = Load(data + 112, next + 112);
+
+        for (auto t = 0; t < 80; t += 16)
+        {
+            Store(first, second, t + 0, x0);
+            Store(first, second, t + 2, x1);
+            Store(first, second, t + 4, x2);
+            Store(first, second, t + 6, x3);
+            Store(first, second, t + 8, x4);
+            Store(first, second, t + 10, x5);
+            Store(first, second, t + 12, x6);
+            Store(first, second, t + 14, x7);
+
+            if (t < 64)
+            {
+                x0 = Schedule(x0, x1, x4, x5, x7);
+                x1 = Schedule(x1, x2, x5, x6, x0);
+                x2 = Schedule(x2, x3, x6, x7, x1);
+                x3 = Schedule(x3, x4, x7, x0, x2);
+                x4 = Schedule(x4, x5, x0, x1, x3);
+                x5 = Schedule(x5, x6, x1, x2, x4);
+                x6 = Schedule(x6, x7, x2, x3, x5);
+                x7 = Schedule(x7, x0, x3, x4, x6);
+            }
+        }
+
+        // Rounds are serially dependent across blocks.
+        Rounds(state, first);
+
+        if (pair)
+            Rounds(state, second);
+
+        const auto consumed = pair ? 2u : 1u;
+        data += consumed * 128;
+        blocks -= consumed;
+    }
+}
+
+// One block, schedule in two lanes.
+void sha512_x1_avx2(uint64_t state[8], const uint8_t block[128]) NOEXCEPT
+{
+    return sha512_avx2(state, block, 1);
+}
+
+} // namespace intrinsics
+} // namespace system
+} // namespace libbitcoin
+
+#endif // WITH_AVX2
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/define.hpp>
+
+#ifdef WITH_AVX2
+
+#include <stdint.h>
+#include <string.h>
+#include <immintrin.h>
+
+namespace libbitcoin {
+namespace system {
+namespace intrinsics {
+
+// SipHash-2-4 of 4 independent messages (same key), one message per lane.
+// Messages may differ in length, a lane's state is frozen (by blend) once its
+// final (length) word has been compressed, and all lanes finalize together.
+
+static inline __m256i Rol(__m256i x, int n) NOEXCEPT
+{
+    return _mm256_or_si256(_mm256_slli_epi64(x, n),
+        _mm256_srli_epi64(x, 64 - n));
+}
+
+static inline __m256i Rol32(__m256i x) NOEXCEPT
+{
+    return _mm256_shuffle_epi32(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+static inline void SipRound(__m256i& v0, __m256i& v1, __m256i& v2,
+    __m256i& v3) NOEXCEPT
+{
+    v0 = _mm256_add_epi64(v0, v1);
+    v2 = _mm256_add_epi64(v2, v3);
+    v1 = Rol(v1, 13);
+    v3 = Rol(v3, 16);
+    v1 = _mm256_xor_si256(v1, v0);
+    v3 = _mm256_xor_si256(v3, v2);
+    v0 = Rol32(v0);
+    v2 = _mm256_add_epi64(v2, v1);
+    v0 = _mm256_add_epi64(v0, v3);
+    v1 = Rol(v1, 17);
+    v3 = Rol(v3, 21);
+    v1 = _mm256_xor_si256(v1, v2);
+    v3 = _mm256_xor_si256(v3, v0);
+    v2 = Rol32(v2);
+}
+
+// Word 'index' of the padded message (final word carries the length byte).
+static inline uint64_t Word(const uint8_t* message, size_t size,
+    size_t index) NOEXCEPT
+{
+    uint64_t word = 0;
+    const auto offset = index * 8;
+    if (offset + 8 <= size)
+    {
+        memcpy(&word, &message[offset], 8);
+    }
+    else
+    {
+        uint8_t tail[8] = { 0 };
+        if (size > offset)
+            memcpy(tail, &message[offset], size - offset);
+
+        tail[7] = static_cast<uint8_t>(size);
+        memcpy(&word, tail, 8);
+    }
+
+    // Little endian (x86).
+    return word;
+}
+
+void siphash_x4_avx2(uint64_t out[4], const uint64_t key[2],
+    const uint8_t* const messages[4], const size_t sizes[4]) NOEXCEPT
+{
+    const auto k0 = _mm256_set1_epi64x(static_cast<int64_t>(key[0]));
+    const auto k1 = _mm256_set1_epi64x(static_cast<int64_t>(key[1]));
+    auto v0 = _mm256_xor_si256(k0, _mm256_set1_epi64x(0x736f6d6570736575));
+    auto v1 = _mm256_xor_si256(k1, _mm256_set1_epi64x(0x646f72616e646f6d));
+    auto v2 = _mm256_xor_si256(k0, _mm256_set1_epi64x(0x6c7967656e657261));
+    auto v3 = _mm256_xor_si256(k1, _mm256_set1_epi64x(0x7465646279746573));
+
+    // Each message compresses (size / 8) + 1 words.
+    size_t words[4];
+    size_t most = 0;
+    for (auto lane = 0; lane < 4; ++lane)
+    {
+        words[lane] = sizes[lane] / 8 + 1;
+        if (words[lane] > most) most = words[lane];
+    }
+
+    const auto counts = _mm256_set_epi64x(
+        static_cast<int64_t>(words[3]), static_cast<int64_t>(words[2]),
+        static_cast<int64_t>(words[1]), static_cast<int64_t>(words[0]));
+
+    for (size_t index = 0; index < most; ++index)
+    {
+        uint64_t lanes[4];
+        for (auto lane = 0; lane < 4; ++lane)
+            lanes[lane] = index < words[lane] ?
+                Word(messages[lane], sizes[lane], index) : 0;
+
+        const auto m = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(lanes));
+        const auto active = _mm256_cmpgt_epi64(counts,
+            _mm256_set1_epi64x(static_cast<int64_t>(index)));
+
+        auto w0 = v0, w1 = v1, w2 = v2;
+        auto w3 = _mm256_xor_si256(v3, m);
+        SipRound(w0, w1, w2, w3);
+        SipRound(w0, w1, w2, w3);
+        w0 = _mm256_xor_si256(w0, m);
+
+        v0 = _mm256_blendv_epi8(v0, w0, active);
+        v1 = _mm256_blendv_epi8(v1, w1, active);
+        v2 = _mm256_blendv_epi8(v2, w2, active);
+        v3 = _mm256_blendv_epi8(v3, w3, active);
+    }
+
+    v2 = _mm256_xor_si256(v2, _mm256_set1_epi64x(0xff));
+    SipRound(v0, v1, v2, v3);
+    SipRound(v0, v1, v2, v3);
+    SipRound(v0, v1, v2, v3);
+    SipRound(v0, v1, v2, v3);
+
+    const auto hash = _mm256_xor_si256(_mm256_xor_si256(v0, v1),
+        _mm256_xor_si256(v2, v3));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), hash);
+}
+
+} // namespace intrinsics
+} // namespace system
+} // namespace libbitcoin
+
+#endif // WITH_AVX2
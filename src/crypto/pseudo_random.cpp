@@ -43,6 +43,31 @@ void pseudo_random::fill(data_chunk& out) NOEXCEPT
     });
 }
 
+bool pseudo_random::entropy(const data_slab& out) NOEXCEPT
+{
+    data_chunk bytes(out.size());
+
+    // std::random_device throws if the device is unavailable.
+    try
+    {
+        std::random_device device{};
+        for (auto byte = bytes.begin(); byte != bytes.end();)
+        {
+            auto value = device();
+            for (size_t index = 0; index < sizeof(value) &&
+                byte != bytes.end(); ++index, value >>= byte_bits)
+                *byte++ = static_cast<uint8_t>(value);
+        }
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    std::copy(bytes.begin(), bytes.end(), out.begin());
+    return true;
+}
+
 uint8_t pseudo_random::next() NOEXCEPT
 {
     return next(minimum<uint8_t>, maximum<uint8_t>);
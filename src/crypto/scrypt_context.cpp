@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/scrypt_context.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <bitcoin/system/crypto/external/external.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+scrypt_context::scrypt_context(size_t threads) NOEXCEPT
+  : threads_(threads)
+{
+}
+
+data_chunk scrypt_context::hash(const data_slice& data,
+    const data_slice& salt, uint64_t work, uint32_t resources,
+    uint32_t parallelism, size_t length) NOEXCEPT
+{
+    data_chunk out(length, 0_u8);
+    compute(out.data(), out.size(), data, salt, work, resources, parallelism);
+    return out;
+}
+
+void scrypt_context::clear() NOEXCEPT
+{
+    block_ = {};
+    scratch_ = {};
+    vector_ = {};
+}
+
+// Buffers are grown (never shrunk), so repeated calls with the same
+// parameters allocate only once. The output is zeroized on failure.
+bool scrypt_context::compute(uint8_t* out, size_t length,
+    const data_slice& data, const data_slice& salt, uint64_t work,
+    uint32_t resources, uint32_t parallelism) NOEXCEPT
+{
+    const auto threads = is_zero(threads_) ?
+        crypto_scrypt_threads(parallelism) :
+        static_cast<uint32_t>(std::min<size_t>(threads_, parallelism));
+
+    // Single threaded is retried if the parallel allocation fails.
+    auto used = threads;
+    if (!reserve(used, work, resources, parallelism))
+        used = (used > 1_u32 && reserve(1_u32, work, resources,
+            parallelism)) ? 1_u32 : 0_u32;
+
+    if (is_zero(used) || crypto_scrypt_buffers(data.data(), data.size(),
+        salt.data(), salt.size(), work, resources, parallelism, out, length,
+        used, block_.data(), scratch_.data(), vector_.data()) != 0)
+    {
+        std::fill_n(out, length, 0_u8);
+        return false;
+    }
+
+    return true;
+}
+
+// Parallel lanes multiply the vector size by the thread count.
+bool scrypt_context::reserve(uint32_t threads, uint64_t work,
+    uint32_t resources, uint32_t parallelism) NOEXCEPT
+{
+    size_t block{}, scratch{}, vector{};
+    if (crypto_scrypt_sizes(work, resources, parallelism, threads, &block,
+        &scratch, &vector) != 0)
+        return false;
+
+    try
+    {
+        if (block_.size() < block) block_.resize(block);
+        if (scratch_.size() < scratch) scratch_.resize(scratch);
+        if (vector_.size() < vector) vector_.resize(vector);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace system
+} // namespace libbitcoin
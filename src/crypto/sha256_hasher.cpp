@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/sha256_hasher.hpp>
+
+#include <bitcoin/system/crypto/hash.hpp>
+#include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+using namespace intrinsics;
+
+constexpr auto sha256_block_size = 64_u64;
+
+sha256_hasher::sha256_hasher() NOEXCEPT
+  : context_{}
+{
+}
+
+// The context bit count is stored as { high, low } 32 bit words.
+sha256_hasher::sha256_hasher(const midstate& state) NOEXCEPT
+  : context_{}
+{
+    const auto count = to_bits(state.blocks * sha256_block_size);
+    context_.state = state.state;
+    context_.count[0] = narrow_cast<uint32_t>(count >> bits<uint32_t>);
+    context_.count[1] = narrow_cast<uint32_t>(count);
+}
+
+sha256_hasher& sha256_hasher::update(const data_slice& data) NOEXCEPT
+{
+    sha256_update(context_, data.data(), data.size());
+    return *this;
+}
+
+hash_digest sha256_hasher::finalize() const NOEXCEPT
+{
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    hash_digest hash;
+    BC_POP_WARNING()
+
+    auto copy = context_;
+    sha256_finalize(copy, hash.data());
+    return hash;
+}
+
+hash_digest sha256_hasher::finalize_double() const NOEXCEPT
+{
+    return sha256_hash(finalize());
+}
+
+bool sha256_hasher::export_midstate(midstate& out) const NOEXCEPT
+{
+    const auto bytes = size();
+    if (!is_zero(bytes % sha256_block_size))
+        return false;
+
+    out.state = context_.state;
+    out.blocks = bytes / sha256_block_size;
+    return true;
+}
+
+uint64_t sha256_hasher::size() const NOEXCEPT
+{
+    const auto count = (uint64_t{ context_.count[0] } << bits<uint32_t>) |
+        context_.count[1];
+    return to_floored_bytes(count);
+}
+
+void sha256_hasher::reset() NOEXCEPT
+{
+    context_ = {};
+}
+
+} // namespace system
+} // namespace libbitcoin
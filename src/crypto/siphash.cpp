@@ -21,7 +21,11 @@
 
 #include <bitcoin/system/crypto/siphash.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <tuple>
+#include <vector>
+#include <bitcoin/system/crypto/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/endian/endian.hpp>
@@ -37,6 +41,9 @@ constexpr uint64_t siphash_magic_3 = 0x7465646279746573;
 constexpr uint64_t finalization = 0x00000000000000ff;
 constexpr uint64_t max_encoded_byte_count = (1 << byte_bits);
 
+// Messages per batch task, below which a parallel policy is not worthwhile.
+constexpr size_t siphash_batch_chunk = 4096;
+
 // C++14: can make constexpr.
 static void sip_round(uint64_t& v0, uint64_t& v1, uint64_t& v2,
     uint64_t& v3) NOEXCEPT
@@ -105,6 +112,33 @@ uint64_t siphash(const siphash_key& key, const data_slice& message) NOEXCEPT
     return v0 ^ v1 ^ v2 ^ v3;
 }
 
+std::vector<uint64_t> siphash_batch(const siphash_key& key,
+    const data_stack& messages) NOEXCEPT
+{
+    const auto count = messages.size();
+    const uint64_t keys[2]{ std::get<0>(key), std::get<1>(key) };
+    std::vector<const uint8_t*> data(count);
+    std::vector<size_t> sizes(count);
+    static no_fill_allocator<uint64_t> no_fill_uint64_allocator{};
+    std::vector<uint64_t> out(count, no_fill_uint64_allocator);
+
+    for (auto index = zero; index < count; ++index)
+    {
+        data[index] = messages[index].data();
+        sizes[index] = messages[index].size();
+    }
+
+    parallel_for(ceilinged_divide(count, siphash_batch_chunk),
+        [&](size_t chunk) NOEXCEPT
+        {
+            const auto first = chunk * siphash_batch_chunk;
+            intrinsics::siphash_multiple(&out[first], keys, &data[first],
+                &sizes[first], std::min(siphash_batch_chunk, count - first));
+        });
+
+    return out;
+}
+
 siphash_key to_siphash_key(const half_hash& hash) NOEXCEPT
 {
     const auto part = split(hash);
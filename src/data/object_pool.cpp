@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/data/object_pool.hpp>
+
+#include <array>
+#include <new>
+#include <numeric>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// Freed blocks are linked through their own first bytes.
+struct free_block
+{
+    free_block* next;
+};
+
+struct free_lists
+{
+    std::array<free_block*, object_pool::size_classes> heads{};
+    std::array<size_t, object_pool::size_classes> counts{};
+
+    ~free_lists() NOEXCEPT
+    {
+        release();
+    }
+
+    void release() NOEXCEPT
+    {
+        for (auto index = zero; index < heads.size(); ++index)
+        {
+            while (heads[index] != nullptr)
+            {
+                const auto next = heads[index]->next;
+                ::operator delete(heads[index]);
+                heads[index] = next;
+            }
+
+            counts[index] = zero;
+        }
+    }
+};
+
+// Retention is checked before the (comparatively costly) thread_specific_ptr
+// lookup, so a thread that does not retain never creates its lists. Zero
+// retention implies no retained blocks. These are trivially destructible and
+// so remain valid throughout thread exit.
+thread_local size_t thread_retention{ zero };
+thread_local bool thread_finalized{ false };
+
+static free_lists& get_lists() NOEXCEPT
+{
+    // Boost.thread will clean up the thread statics using this function.
+    // Other thread exit cleanup may free pooled blocks after this, so
+    // retention is zeroed and finalized, preventing recreation of lists.
+    const auto deleter = [](free_lists* lists) NOEXCEPT
+    {
+        thread_retention = zero;
+        thread_finalized = true;
+        delete lists;
+    };
+
+    // Maintain thread static state space.
+    // This throws given insufficient resources.
+    static boost::thread_specific_ptr<free_lists> lists(deleter);
+
+    // This is thread safe because the instance is thread static.
+    if (lists.get() == nullptr)
+        lists.reset(new free_lists{});
+
+    // The instance remains in scope and is deleted by thread_specific_ptr
+    // when the thread terminates, so dereferencing the instance is safe.
+    return *lists;
+}
+
+// Size class of bytes in (0..maximum_size], rounded up to granularity.
+constexpr size_t size_class(size_t bytes) NOEXCEPT
+{
+    return sub1(ceilinged_divide(bytes, object_pool::granularity));
+}
+
+void* object_pool::allocate(size_t bytes) THROWS
+{
+    if (is_zero(bytes) || bytes > maximum_size)
+        return ::operator new(bytes);
+
+    // Blocks are always of the full size class, as any may be retained (by
+    // any thread) when freed.
+    const auto index = size_class(bytes);
+    const auto size = add1(index) * granularity;
+    if (is_zero(thread_retention))
+        return ::operator new(size);
+
+    auto& lists = get_lists();
+    const auto head = lists.heads[index];
+
+    if (head == nullptr)
+        return ::operator new(size);
+
+    lists.heads[index] = head->next;
+    --lists.counts[index];
+    return head;
+}
+
+void object_pool::deallocate(void* block, size_t bytes) NOEXCEPT
+{
+    if (block == nullptr)
+        return;
+
+    if (is_zero(thread_retention) || is_zero(bytes) || bytes > maximum_size)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    const auto index = size_class(bytes);
+    auto& lists = get_lists();
+
+    // Bounded retention, excess blocks are released.
+    if (lists.counts[index] >= thread_retention)
+    {
+        ::operator delete(block);
+        return;
+    }
+
+    BC_PUSH_WARNING(NO_REINTERPRET_CAST)
+    const auto freed = reinterpret_cast<free_block*>(block);
+    BC_POP_WARNING()
+
+    freed->next = lists.heads[index];
+    lists.heads[index] = freed;
+    ++lists.counts[index];
+}
+
+size_t object_pool::retention() NOEXCEPT
+{
+    return thread_retention;
+}
+
+void object_pool::set_retention(size_t blocks) NOEXCEPT
+{
+    // Lists are not recreated once destroyed by thread exit.
+    if (thread_finalized)
+        return;
+
+    // Reducing retention releases all retained blocks.
+    if (blocks < thread_retention)
+        get_lists().release();
+
+    thread_retention = blocks;
+}
+
+size_t object_pool::retained() NOEXCEPT
+{
+    if (is_zero(thread_retention))
+        return zero;
+
+    const auto& counts = get_lists().counts;
+    return std::accumulate(counts.begin(), counts.end(), zero);
+}
+
+void object_pool::trim() NOEXCEPT
+{
+    if (!is_zero(thread_retention))
+        get_lists().release();
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/data/parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Pool threads, and a caller while claiming ranges of its own dispatch, run
+// nested dispatches inline (the pool is in use, and busy_ may be held).
+static thread_local bool pool_thread{ false };
+static thread_local bool dispatching{ false };
+
+// Persistent workers, created once, so that thread statics (such as signing
+// contexts) survive across dispatches. One dispatch runs at a time, the
+// caller claims ranges alongside the workers.
+class worker_pool
+{
+public:
+    worker_pool() NOEXCEPT
+    {
+        const auto cores = std::max(one,
+            static_cast<size_t>(std::thread::hardware_concurrency()));
+
+        try
+        {
+            workers_.reserve(sub1(cores));
+            for (auto worker = one; worker < cores; ++worker)
+                workers_.emplace_back(&worker_pool::work, this);
+        }
+        catch (const std::exception&)
+        {
+            // Threads that could not be started are not used.
+        }
+    }
+
+    ~worker_pool() NOEXCEPT
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+
+        wake_.notify_all();
+        for (auto& worker: workers_)
+            worker.join();
+    }
+
+    size_t threads() const NOEXCEPT
+    {
+        return add1(workers_.size());
+    }
+
+    void dispatch(size_t ranges, parallel_range range,
+        const void* context) NOEXCEPT
+    {
+        // Nested dispatch runs inline, without touching busy_ (which may be
+        // held by this thread). Concurrent dispatch also runs inline.
+        if (pool_thread || dispatching || workers_.empty() || ranges <= one)
+        {
+            inline_dispatch(ranges, range, context);
+            return;
+        }
+
+        std::unique_lock<std::mutex> busy(busy_, std::try_to_lock);
+        if (!busy.owns_lock())
+        {
+            inline_dispatch(ranges, range, context);
+            return;
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            range_ = range;
+            context_ = context;
+            ranges_ = ranges;
+            next_.store(zero, std::memory_order_relaxed);
+            ++generation_;
+        }
+
+        wake_.notify_all();
+        dispatching = true;
+        claim(range, context, ranges);
+        dispatching = false;
+
+        // Workers that have not yet joined the job will not join it.
+        std::unique_lock<std::mutex> lock(mutex_);
+        range_ = nullptr;
+        done_.wait(lock, [this]() NOEXCEPT { return is_zero(active_); });
+    }
+
+private:
+    static void inline_dispatch(size_t ranges, parallel_range range,
+        const void* context) NOEXCEPT
+    {
+        for (auto index = zero; index < ranges; ++index)
+            range(context, index);
+    }
+
+    void claim(parallel_range range, const void* context,
+        size_t ranges) NOEXCEPT
+    {
+        for (auto index = next_.fetch_add(one, std::memory_order_relaxed);
+            index < ranges;
+            index = next_.fetch_add(one, std::memory_order_relaxed))
+            range(context, index);
+    }
+
+    void work() NOEXCEPT
+    {
+        pool_thread = true;
+        uint64_t seen{ zero };
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        while (true)
+        {
+            wake_.wait(lock, [&]() NOEXCEPT
+            {
+                return stop_ || seen != generation_;
+            });
+
+            if (stop_)
+                return;
+
+            seen = generation_;
+            if (range_ == nullptr)
+                continue;
+
+            const auto range = range_;
+            const auto context = context_;
+            const auto ranges = ranges_;
+            ++active_;
+            lock.unlock();
+
+            claim(range, context, ranges);
+
+            lock.lock();
+            if (is_zero(--active_))
+                done_.notify_one();
+        }
+    }
+
+    // Guards dispatch (one job at a time).
+    std::mutex busy_{};
+
+    // Guards the job and worker state below.
+    std::mutex mutex_{};
+    std::condition_variable wake_{};
+    std::condition_variable done_{};
+    parallel_range range_{ nullptr };
+    const void* context_{ nullptr };
+    size_t ranges_{ zero };
+    size_t active_{ zero };
+    uint64_t generation_{ zero };
+    bool stop_{ false };
+
+    std::atomic<size_t> next_{ zero };
+    std::vector<std::thread> workers_{};
+};
+
+BC_POP_WARNING()
+
+static worker_pool& pool() NOEXCEPT
+{
+    static worker_pool instance{};
+    return instance;
+}
+
+size_t parallel_threads() NOEXCEPT
+{
+    return pool().threads();
+}
+
+void parallel_dispatch(size_t ranges, parallel_range range,
+    const void* context) NOEXCEPT
+{
+    pool().dispatch(ranges, range, context);
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -36,7 +36,7 @@ namespace libbitcoin {
 namespace system {
 
 constexpr char encode[] = "qpzry9x8gf2tvdw0s3jn54khce6mua7l";
-constexpr uint8_t decode[] =
+constexpr uint8_t decode[256] =
 {
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
     0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
@@ -53,7 +53,23 @@ constexpr uint8_t decode[] =
     0xff, 29,   0xff, 24,   13,   25,   9,    8,
     23,   0xff, 18,   22,   31,   27,   19,   0xff,
     1,    0,    3,    16,   11,   28,   12,   14,
-    6,    4,    2,    0xff, 0xff, 0xff, 0xff, 0xff
+    6,    4,    2,    0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
 
 // encode
@@ -85,7 +101,7 @@ bool decode_base32(base32_chunk& out, const std::string& in) NOEXCEPT
     out.clear();
     out.reserve(in.size());
 
-    // decode[] cannot be out of bounds because char are < 256.
+    // decode[] cannot be out of bounds because it has 256 entries.
     for (auto character: in)
     {
         const auto value = decode[static_cast<uint8_t>(character)];
@@ -109,6 +125,19 @@ bool decode_base32(data_chunk& out, const std::string& in) NOEXCEPT
     return true;
 }
 
+// character/value
+
+char base32_character(uint8_t value) NOEXCEPT
+{
+    BC_ASSERT(value < 32u);
+    return encode[value & 0x1f];
+}
+
+uint8_t base32_value(char character) NOEXCEPT
+{
+    return decode[static_cast<uint8_t>(character)];
+}
+
 // pack/unpack
 
 data_chunk base32_pack(const base32_chunk& unpacked) NOEXCEPT
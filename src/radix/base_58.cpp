@@ -19,8 +19,14 @@
 #include <bitcoin/system/radix/base_58.hpp>
 
 #include <algorithm>
+#include <array>
+#include <iterator>
+#include <string>
+#include <vector>
 /// DELETEMENOW
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
 
 // base58
 // Base 58 is an ascii data encoding with a domain of 58 symbols (characters).
@@ -29,14 +35,28 @@
 namespace libbitcoin {
 namespace system {
 
-const std::string base58_chars =
+// Conversions are performed on limbs of five base58 digits (58^5 < 2^32).
+constexpr uint64_t base58_limb = 656356768u;
+constexpr size_t base58_limb_digits = 5;
+constexpr size_t base58_limb_bytes = 4;
+constexpr uint8_t base58_invalid = max_uint8;
+constexpr char base58_characters[] =
     "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
+// Character values by (unsigned) character, base58_invalid if not base58.
+constexpr auto base58_values = []() NOEXCEPT
+{
+    std::array<uint8_t, 256> values{};
+    values.fill(base58_invalid);
+    for (uint8_t index = 0; index < 58u; ++index)
+        values[static_cast<uint8_t>(base58_characters[index])] = index;
+
+    return values;
+}();
+
 bool is_base58(char character) NOEXCEPT
 {
-    // The base58 character list is lexically sorted.
-    return std::binary_search(base58_chars.begin(), base58_chars.end(),
-        character);
+    return base58_values[static_cast<uint8_t>(character)] != base58_invalid;
 }
 
 bool is_base58(const std::string& text) NOEXCEPT
@@ -49,24 +69,34 @@ bool is_base58(const std::string& text) NOEXCEPT
     return std::all_of(text.begin(), text.end(), test);
 }
 
-template <typename Data>
-static auto find_first_nonzero(const Data& data) NOEXCEPT ->
-    decltype(data.cbegin())
+// Conversions consume up to four bytes (encode) or five characters (decode)
+// per pass over the limbs. Each limb product then fits in 64 bits and the
+// number of passes over the working number is reduced by four to five times.
+constexpr size_t base58_stack_limbs = 32;
+static_assert(base58_limb == power(58u, base58_limb_digits));
+
+static size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
 {
-    auto first_nonzero = data.cbegin();
-    while (first_nonzero != data.end() && is_zero(*first_nonzero))
-        ++first_nonzero;
+    // Skip and count leading zeros.
+    size_t leading_zeros = 0;
+    for (const auto byte: unencoded)
+    {
+        if (!is_zero(byte))
+            break;
 
-    return first_nonzero;
+        ++leading_zeros;
+    }
+
+    return leading_zeros;
 }
 
-size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
+static size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
 {
     // Skip and count leading '1's.
     size_t leading_zeros = 0;
-    for (const auto byte: unencoded)
+    for (const auto digit: encoded)
     {
-        if (!is_zero(byte))
+        if (digit != base58_characters[0])
             break;
 
         ++leading_zeros;
@@ -75,112 +105,229 @@ size_t count_leading_zeros(const data_slice& unencoded) NOEXCEPT
     return leading_zeros;
 }
 
-void pack_value(data_chunk& indexes, size_t carry) NOEXCEPT
+// Limbs are little-endian (least significant limb first), on the stack unless
+// the number is large.
+class base58_limbs
 {
-    // Apply "b58 = b58 * 256 + ch".
-    for (auto it = indexes.rbegin(); it != indexes.rend(); ++it)
+public:
+    base58_limbs(size_t count) NOEXCEPT
+      : heap_(count > base58_stack_limbs ? count : zero),
+        limbs_(heap_.empty() ? stack_.data() : heap_.data()),
+        used_(zero)
     {
-        carry += 256u * (*it);
-        *it = carry % 58u;
-        carry /= 58u;
     }
 
-    BC_ASSERT(is_zero(carry));
-}
+    // Apply "number = number * scale + carry".
+    template <uint64_t Base>
+    void multiply_add(uint64_t scale, uint64_t carry) NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        for (size_t limb = 0; limb < used_; ++limb)
+        {
+            carry += limbs_[limb] * scale;
+            limbs_[limb] = carry % Base;
+            carry /= Base;
+        }
+
+        while (is_nonzero(carry))
+        {
+            limbs_[used_++] = carry % Base;
+            carry /= Base;
+        }
+        BC_POP_WARNING()
+    }
 
-std::string encode_base58(const data_slice& unencoded) NOEXCEPT
+    size_t used() const NOEXCEPT
+    {
+        return used_;
+    }
+
+    uint64_t operator[](size_t limb) const NOEXCEPT
+    {
+        BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+        return limbs_[limb];
+        BC_POP_WARNING()
+    }
+
+private:
+    std::array<uint64_t, base58_stack_limbs> stack_;
+    std::vector<uint64_t> heap_;
+    uint64_t* limbs_;
+    size_t used_;
+};
+
+void append_base58(std::string& out, const data_slice& unencoded) NOEXCEPT
 {
     const auto leading_zeros = count_leading_zeros(unencoded);
+    out.append(leading_zeros, base58_characters[0]);
 
     // size = log(256) / log(58), rounded up.
     const auto number_nonzero = unencoded.size() - leading_zeros;
-    const auto indexes_size = add1(number_nonzero * 138u / 100u);
-
-    // Allocate enough space in big-endian base58 representation.
-    data_chunk indexes(indexes_size);
+    const auto digits = add1(number_nonzero * 138u / 100u);
+    base58_limbs limbs{ add1(ceilinged_divide(digits, base58_limb_digits)) };
 
-    // Process the bytes.
-    for (auto it = std::next(unencoded.begin(), leading_zeros);
-        it != unencoded.end(); ++it)
+    // Process the bytes, a partial group first so that the rest are whole.
+    auto remaining = number_nonzero;
+    auto byte = std::next(unencoded.begin(), leading_zeros);
+    while (is_nonzero(remaining))
     {
-        pack_value(indexes, *it);
-    }
+        auto count = remaining % base58_limb_bytes;
+        if (is_zero(count))
+            count = base58_limb_bytes;
 
-    // Skip leading zeros in base58 result.
-    const auto first_nonzero = find_first_nonzero(indexes);
+        uint64_t carry = 0;
+        for (size_t index = 0; index < count; ++index)
+            carry = (carry << byte_bits) | *byte++;
 
-    // Translate the result into a string.
-    std::string encoded;
-    const size_t estimated_size = leading_zeros +
-        (indexes.end() - first_nonzero);
-    encoded.reserve(estimated_size);
-    encoded.assign(leading_zeros, '1');
+        limbs.multiply_add<base58_limb>(power2<uint64_t>(count * byte_bits),
+            carry);
 
-    // Set actual main bytes.
-    for (auto it = first_nonzero; it != indexes.end(); ++it)
-        encoded += base58_chars[*it];
+        remaining -= count;
+    }
 
-    return encoded;
-}
+    if (is_zero(limbs.used()))
+        return;
 
-size_t count_leading_zeros(const std::string& encoded) NOEXCEPT
-{
-    // Skip and count leading '1's.
-    size_t leading_zeros = 0;
-    for (const auto digit: encoded)
+    // The most significant limb is written without leading zeros.
+    char buffer[base58_limb_digits];
+    auto limb = limbs[sub1(limbs.used())];
+    size_t count = 0;
+    for (; is_nonzero(limb); limb /= 58u)
+        buffer[count++] = base58_characters[limb % 58u];
+
+    out.append(std::make_reverse_iterator(std::next(buffer, count)),
+        std::make_reverse_iterator(std::begin(buffer)));
+
+    for (auto index = sub1(limbs.used()); is_nonzero(index); --index)
     {
-        if (digit != base58_chars[0])
-            break;
+        limb = limbs[sub1(index)];
+        for (auto digit = base58_limb_digits; is_nonzero(digit); limb /= 58u)
+            buffer[--digit] = base58_characters[limb % 58u];
 
-        ++leading_zeros;
+        out.append(std::begin(buffer), std::end(buffer));
     }
+}
 
-    return leading_zeros;
+std::string encode_base58(const data_slice& unencoded) NOEXCEPT
+{
+    std::string encoded;
+    encoded.reserve(add1(unencoded.size() * 138u / 100u));
+    append_base58(encoded, unencoded);
+    return encoded;
+}
+
+static size_t limb_count(size_t number_nonzero) NOEXCEPT
+{
+    // log(58) / log(256), rounded up.
+    const auto bytes = add1(number_nonzero * 733u / 1000u);
+    return add1(ceilinged_divide(bytes, base58_limb_bytes));
 }
 
-void unpack_char(data_chunk& data, size_t carry) NOEXCEPT
+static bool read_base58(base58_limbs& limbs, const std::string& in,
+    size_t leading_zeros) NOEXCEPT
 {
-    for (auto it = data.rbegin(); it != data.rend(); it++)
+    // Process the characters, a partial group first so that the rest are whole.
+    auto remaining = in.size() - leading_zeros;
+    auto character = std::next(in.begin(), leading_zeros);
+    while (is_nonzero(remaining))
     {
-        carry += 58 * (*it);
-        *it = carry % 256;
-        carry /= 256;
+        auto count = remaining % base58_limb_digits;
+        if (is_zero(count))
+            count = base58_limb_digits;
+
+        uint64_t scale = 1;
+        uint64_t carry = 0;
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto value = base58_values[static_cast<uint8_t>(*character++)];
+            if (value == base58_invalid)
+                return false;
+
+            carry = carry * 58u + value;
+            scale *= 58u;
+        }
+
+        limbs.multiply_add<power2<uint64_t>(bits<uint32_t>)>(scale, carry);
+        remaining -= count;
     }
 
-    BC_ASSERT(is_zero(carry));
+    return true;
 }
 
 bool decode_base58(data_chunk& out, const std::string& in) NOEXCEPT
 {
     out.clear();
-
-    // Trim spaces and newlines around the string.
     const auto leading_zeros = count_leading_zeros(in);
+    base58_limbs limbs{ limb_count(in.size() - leading_zeros) };
+    if (!read_base58(limbs, in, leading_zeros))
+        return false;
 
-    // log(58) / log(256), rounded up.
-    const size_t data_size = add1(in.size() * 733u / 1000u);
+    out.reserve(leading_zeros + limbs.used() * base58_limb_bytes);
+    out.assign(leading_zeros, 0x00);
+    if (is_zero(limbs.used()))
+        return true;
 
-    // Allocate enough space in big-endian base256 representation.
-    data_chunk data(data_size);
+    // The most significant limb is written without leading zeros.
+    const auto top = limbs[sub1(limbs.used())];
+    for (auto shift = bits<uint32_t>; is_nonzero(shift);)
+    {
+        shift -= byte_bits;
+        if (is_nonzero(top >> shift))
+            out.push_back(narrow_cast<uint8_t>(top >> shift));
+    }
 
-    // Process the characters.
-    for (auto it = in.begin() + leading_zeros; it != in.end(); ++it)
+    for (auto index = sub1(limbs.used()); is_nonzero(index); --index)
     {
-        const auto carry = base58_chars.find(*it);
-        if (carry == std::string::npos)
-            return false;
+        const auto limb = narrow_cast<uint32_t>(limbs[sub1(index)]);
+        const auto big = to_big_endian(limb);
+        out.insert(out.end(), big.begin(), big.end());
+    }
+
+    return true;
+}
 
-        unpack_char(data, carry);
+bool decode_base58(const data_slab& out, const std::string& in) NOEXCEPT
+{
+    const auto leading_zeros = count_leading_zeros(in);
+    if (leading_zeros > out.size())
+        return false;
+
+    // Bound significant characters before conversion (log(256) / log(58)).
+    const auto number_nonzero = in.size() - leading_zeros;
+    if (number_nonzero > add1(out.size() * 138u / 100u))
+        return false;
+
+    base58_limbs limbs{ limb_count(number_nonzero) };
+    if (!read_base58(limbs, in, leading_zeros))
+        return false;
+
+    // The most significant limb is written without leading zeros.
+    const auto used = limbs.used();
+    const auto top = is_zero(used) ? zero : limbs[sub1(used)];
+    size_t top_bytes = 0;
+    while (is_nonzero(top >> (top_bytes * byte_bits)))
+        ++top_bytes;
+
+    // The number must be exactly the remaining bytes, without a leading zero.
+    const auto bytes = is_zero(used) ? zero :
+        top_bytes + sub1(used) * base58_limb_bytes;
+    if (bytes != out.size() - leading_zeros)
+        return false;
+
+    auto byte = std::fill_n(out.begin(), leading_zeros, 0x00);
+    for (auto shift = top_bytes * byte_bits; is_nonzero(shift);)
+    {
+        shift -= byte_bits;
+        *byte++ = narrow_cast<uint8_t>(top >> shift);
     }
 
-    // Skip leading zeros in data.
-    const auto first_nonzero = find_first_nonzero(data);
+    for (auto index = used; index > one; --index)
+    {
+        const auto limb = narrow_cast<uint32_t>(limbs[index - 2u]);
+        const auto big = to_big_endian(limb);
+        byte = std::copy(big.begin(), big.end(), byte);
+    }
 
-    // Copy result into output vector.
-    const size_t estimated_size = leading_zeros + (data.end() - first_nonzero);
-    out.reserve(estimated_size);
-    out.assign(leading_zeros, 0x00);
-    out.insert(out.end(), first_nonzero, data.cend());
     return true;
 }
 
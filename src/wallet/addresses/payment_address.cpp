@@ -19,11 +19,13 @@
 #include <bitcoin/system/wallet/addresses/payment_address.hpp>
 
 #include <algorithm>
+#include <array>
 /// DELETECSTDINT
 #include <iostream>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 /// DELETEMENOW
@@ -94,24 +96,137 @@ payment_address::payment_address(const short_hash& hash,
 {
 }
 
+// Bulk.
+// ----------------------------------------------------------------------------
+
+// [prefix:1][hash:20][checksum:4], 34 characters at most.
+constexpr size_t payment_encoded_maximum = 34;
+constexpr size_t payment_checked_size = add1(short_hash_size);
+constexpr size_t payment_checksum_size = payment::value_size -
+    payment_checked_size;
+constexpr size_t payment_batch = 256;
+
+void payment_address::encode(std::string& out, const short_hash_list& hashes,
+    uint8_t prefix, char delimiter) NOEXCEPT
+{
+    // Checksums are hashed in cache-sized batches across SIMD lanes.
+    std::array<payment::value_type, payment_batch> values;
+    std::array<const uint8_t*, payment_batch> messages;
+    std::array<size_t, payment_batch> sizes;
+    std::array<hash_digest, payment_batch> checksums;
+    sizes.fill(payment_checked_size);
+
+    out.reserve(out.size() + hashes.size() * add1(payment_encoded_maximum));
+    for (size_t first = 0; first < hashes.size(); first += payment_batch)
+    {
+        const auto count = std::min(payment_batch, hashes.size() - first);
+        for (size_t index = 0; index < count; ++index)
+        {
+            auto& value = values[index];
+            const auto& hash = hashes[first + index];
+            value.front() = prefix;
+            std::copy(hash.begin(), hash.end(), std::next(value.begin()));
+            messages[index] = value.data();
+        }
+
+        // Checksums are the leading four bytes of each double sha256.
+        intrinsics::double_sha256_multiple(checksums.front().data(),
+            messages.data(), sizes.data(), count);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            auto& value = values[index];
+            std::copy_n(checksums[index].begin(), payment_checksum_size,
+                std::next(value.begin(), payment_checked_size));
+
+            if (is_nonzero(first + index))
+                out.push_back(delimiter);
+
+            append_base58(out, value);
+        }
+    }
+}
+
+bool payment_address::decode(short_hash_list& out,
+    const std::string& addresses, uint8_t prefix, char delimiter) NOEXCEPT
+{
+    if (addresses.empty())
+        return true;
+
+    std::array<payment::value_type, payment_batch> values;
+    std::array<const uint8_t*, payment_batch> messages;
+    std::array<size_t, payment_batch> sizes;
+    std::array<hash_digest, payment_batch> checksums;
+    sizes.fill(payment_checked_size);
+
+    short_hash_list hashes;
+    std::string address;
+    data_chunk decoded;
+    size_t count = 0;
+
+    // Verify the batched checksums and extract hashes.
+    const auto verify = [&]() NOEXCEPT
+    {
+        intrinsics::double_sha256_multiple(checksums.front().data(),
+            messages.data(), sizes.data(), count);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto& value = values[index];
+            const auto checksum = checksums[index].begin();
+            const auto check = std::next(value.begin(), payment_checked_size);
+            if (!std::equal(check, value.end(), checksum))
+                return false;
+
+            hashes.emplace_back();
+            std::copy(std::next(value.begin()), check, hashes.back().begin());
+        }
+
+        count = 0;
+        return true;
+    };
+
+    for (size_t start = 0; start <= addresses.size();)
+    {
+        auto end = addresses.find(delimiter, start);
+        if (end == std::string::npos)
+            end = addresses.size();
+
+        address.assign(addresses, start, end - start);
+        if (!decode_base58(decoded, address) ||
+            decoded.size() != payment::value_size ||
+            decoded.front() != prefix)
+            return false;
+
+        auto& value = values[count];
+        std::copy(decoded.begin(), decoded.end(), value.begin());
+        messages[count++] = value.data();
+
+        if (count == payment_batch && !verify())
+            return false;
+
+        start = add1(end);
+    }
+
+    if (is_nonzero(count) && !verify())
+        return false;
+
+    out.insert(out.end(), hashes.begin(), hashes.end());
+    return true;
+}
+
 // Factories.
 // ----------------------------------------------------------------------------
 
 payment_address payment_address::from_string(
     const std::string& address) NOEXCEPT
 {
-    data_array<payment::value_size> decoded;
-    if (!decode_base58(decoded, address) || 
-        decoded.size() != payment::value_size)
-        return {};
-
-    payment value(std::move(decoded));
-
-    // Validates checksum.
-    if (!value)
+    // Validates size and checksum.
+    payment::value_type decoded;
+    if (!decode_base58_checked(decoded, address))
         return {};
 
-    return { std::move(value) };
+    return { payment{ std::move(decoded) } };
 }
 
 payment_address payment_address::from_private(const ec_private& secret) NOEXCEPT
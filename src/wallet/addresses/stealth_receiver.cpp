@@ -18,9 +18,14 @@
  */
 #include <bitcoin/system/wallet/addresses/stealth_receiver.hpp>
 
+#include <algorithm>
 /// DELETECSTDINT
+#include <vector>
+#include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/wallet/addresses/payment_address.hpp>
 #include <bitcoin/system/wallet/addresses/stealth_address.hpp>
 #include <bitcoin/system/wallet/keys/stealth.hpp>
@@ -29,12 +34,31 @@ namespace libbitcoin {
 namespace system {
 namespace wallet {
 
+using namespace system::chain;
+
+// A filter is the leftmost bits of the stealth prefix bytes (see stealth.cpp).
+static uint32_t filter_mask(const binary& filter) NOEXCEPT
+{
+    const auto size = std::min(filter.bits(), bits<uint32_t>);
+    return is_zero(size) ? 0 : max_uint32 << (bits<uint32_t> - size);
+}
+
+static uint32_t filter_value(const binary& filter) NOEXCEPT
+{
+    data_array<sizeof(uint32_t)> bytes{};
+    std::copy_n(filter.data().begin(),
+        std::min(filter.bytes(), sizeof(uint32_t)), bytes.begin());
+
+    return from_big_endian<uint32_t>(bytes) & filter_mask(filter);
+}
+
 // TODO: use to factory and make address_ and spend_public_ const.
 stealth_receiver::stealth_receiver(const ec_secret& scan_private,
     const ec_secret& spend_private, const binary& filter,
     uint8_t version) NOEXCEPT
   : version_(version), scan_private_(scan_private),
-    spend_private_(spend_private)
+    spend_private_(spend_private), filter_mask_(filter_mask(filter)),
+    filter_value_(filter_value(filter))
 {
     ec_compressed scan_public;
     if (secret_to_public(scan_public, scan_private_) &&
@@ -74,6 +98,81 @@ bool stealth_receiver::derive_private(ec_secret& out_private,
         spend_private_);
 }
 
+// private
+bool stealth_receiver::is_filtered(const script& script) const NOEXCEPT
+{
+    uint32_t prefix;
+    if (!to_stealth_prefix(prefix, script))
+        return false;
+
+    // The prefix is read little-endian, the filter matches leading bytes.
+    const auto leading = from_big_endian<uint32_t>(to_little_endian(prefix));
+    return (leading & filter_mask_) == filter_value_;
+}
+
+bool stealth_receiver::scan(payments& out,
+    const chain::block& block) const NOEXCEPT
+{
+    out.clear();
+    if (!address_)
+        return false;
+
+    // Filtering requires only hashing, leaving few candidates for EC work.
+    payments candidates{};
+    const auto& txs = *block.transactions_ptr();
+    for (size_t tx = 0; tx < txs.size(); ++tx)
+    {
+        const auto& outputs = *txs[tx]->outputs_ptr();
+        for (uint32_t index = 0; index < outputs.size(); ++index)
+        {
+            ec_compressed ephemeral;
+            const auto& script = outputs[index]->script();
+            if (is_filtered(script) && extract_ephemeral_key(ephemeral, script))
+                candidates.push_back({ tx, index, index, ephemeral });
+        }
+    }
+
+    // Derive the payment hash for each candidate (null if underivable).
+    const auto derive = [this](const payment& candidate) NOEXCEPT
+    {
+        ec_compressed receiver_public;
+        if (!uncover_stealth(receiver_public, candidate.ephemeral_public,
+            scan_private_, spend_public_))
+            return short_hash{};
+
+        return bitcoin_short_hash(receiver_public);
+    };
+
+    short_hash_list hashes(candidates.size());
+    parallel_for(candidates.size(), [&](size_t candidate) NOEXCEPT
+    {
+        hashes[candidate] = derive(candidates[candidate]);
+    });
+
+    // Match derived hashes to pay-key-hash outputs of the same transaction.
+    for (size_t candidate = 0; candidate < candidates.size(); ++candidate)
+    {
+        const auto& hash = hashes[candidate];
+        if (hash == short_hash{})
+            continue;
+
+        auto payment = candidates[candidate];
+        const auto& outputs = *txs[payment.transaction]->outputs_ptr();
+        for (uint32_t index = 0; index < outputs.size(); ++index)
+        {
+            const auto& ops = outputs[index]->script().ops();
+            if (script::is_pay_key_hash_pattern(ops) &&
+                std::equal(hash.begin(), hash.end(), ops[2].data().begin()))
+            {
+                payment.output = index;
+                out.push_back(payment);
+            }
+        }
+    }
+
+    return true;
+}
+
 } // namespace wallet
 } // namespace system
 } // namespace libbitcoin
@@ -279,6 +279,166 @@ witness_address::parse_result witness_address::parse_address(
     return parse_result::valid;
 }
 
+// Bulk.
+// ----------------------------------------------------------------------------
+
+// A version 0 p2kh program is 160 bits, exactly 32 base32 values.
+constexpr size_t bech32_value_bits = 5;
+constexpr size_t short_program_length = 32;
+
+// local
+inline bool track_case(bool& lower, bool& upper, char character) NOEXCEPT
+{
+    lower |= (character >= 'a' && character <= 'z');
+    upper |= (character >= 'A' && character <= 'Z');
+    return !(lower && upper);
+}
+
+// local
+inline char to_lower(char character) NOEXCEPT
+{
+    return (character >= 'A' && character <= 'Z') ?
+        static_cast<char>(character - 'A' + 'a') : character;
+}
+
+bool witness_address::encode(std::string& out, const short_hash_list& hashes,
+    const std::string& prefix, char delimiter) NOEXCEPT
+{
+    if (parse_prefix(prefix) != parse_result::valid)
+        return false;
+
+    const auto prefixed = bech32_polymod(bech32_prefix_polymod(prefix),
+        version_0);
+    const auto length = prefix.size() + two + short_program_length +
+        checksum_length;
+
+    out.reserve(out.size() + hashes.size() * add1(length));
+    for (size_t index = 0; index < hashes.size(); ++index)
+    {
+        if (is_nonzero(index))
+            out.push_back(delimiter);
+
+        out.append(prefix);
+        out.push_back(separator);
+        out.push_back(base32_character(version_0));
+
+        auto checksum = prefixed;
+        uint32_t accumulator = 0;
+        size_t pending = 0;
+        for (const auto byte: hashes[index])
+        {
+            accumulator = (accumulator << byte_bits) | byte;
+            pending += byte_bits;
+
+            while (pending >= bech32_value_bits)
+            {
+                pending -= bech32_value_bits;
+                const auto value = narrow_cast<uint8_t>(
+                    (accumulator >> pending) & 0x1f);
+                checksum = bech32_polymod(checksum, value);
+                out.push_back(base32_character(value));
+            }
+        }
+
+        for (size_t value = 0; value < checksum_length; ++value)
+            checksum = bech32_polymod(checksum, 0x00);
+
+        checksum ^= bech32_constant(version_0);
+        for (auto value = checksum_length; is_nonzero(value);)
+        {
+            const auto shift = --value * bech32_value_bits;
+            out.push_back(base32_character(
+                narrow_cast<uint8_t>((checksum >> shift) & 0x1f)));
+        }
+    }
+
+    return true;
+}
+
+bool witness_address::decode(short_hash_list& out,
+    const std::string& addresses, const std::string& prefix,
+    char delimiter) NOEXCEPT
+{
+    if (parse_prefix(prefix) != parse_result::valid)
+        return false;
+
+    if (addresses.empty())
+        return true;
+
+    const auto prefixed = bech32_prefix_polymod(prefix);
+    const auto length = prefix.size() + two + short_program_length +
+        checksum_length;
+
+    short_hash_list hashes;
+    for (size_t start = 0; start <= addresses.size();)
+    {
+        auto end = addresses.find(delimiter, start);
+        if (end == std::string::npos)
+            end = addresses.size();
+
+        if (end - start != length)
+            return false;
+
+        auto character = std::next(addresses.begin(), start);
+        bool lower = false;
+        bool upper = false;
+
+        // Prefix is lower case (parsed), the address may be all upper case.
+        for (const auto expected: prefix)
+        {
+            const auto actual = *character++;
+            if (!track_case(lower, upper, actual) ||
+                to_lower(actual) != expected)
+                return false;
+        }
+
+        if (*character++ != separator)
+            return false;
+
+        auto checksum = prefixed;
+        hashes.emplace_back();
+        auto byte = hashes.back().begin();
+        uint32_t accumulator = 0;
+        size_t pending = 0;
+
+        for (size_t index = 0; index < add1(short_program_length) +
+            checksum_length; ++index)
+        {
+            const auto actual = *character++;
+            const auto value = base32_value(actual);
+            if (value == max_uint8 || !track_case(lower, upper, actual))
+                return false;
+
+            checksum = bech32_polymod(checksum, value);
+
+            // The first value is the version, followed by the program.
+            if (is_zero(index))
+            {
+                if (value != version_0)
+                    return false;
+            }
+            else if (index <= short_program_length)
+            {
+                accumulator = (accumulator << bech32_value_bits) | value;
+                pending += bech32_value_bits;
+                if (pending >= byte_bits)
+                {
+                    pending -= byte_bits;
+                    *byte++ = narrow_cast<uint8_t>(accumulator >> pending);
+                }
+            }
+        }
+
+        if (checksum != bech32_constant(version_0))
+            return false;
+
+        start = add1(end);
+    }
+
+    out.insert(out.end(), hashes.begin(), hashes.end());
+    return true;
+}
+
 // Factories.
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/wallet/keys/hd_cache.hpp>
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/serial/serial.hpp>
+#include <bitcoin/system/unicode/unicode.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace wallet {
+
+static bool is_hardened_marker(char character) NOEXCEPT
+{
+    return character == '\'' || character == 'h' || character == 'H';
+}
+
+bool decode_hd_path(hd_path& out, const std::string& text) NOEXCEPT
+{
+    const auto tokens = split(text, "/", false, false);
+    if (tokens.empty() || tokens.front() != "m")
+        return false;
+
+    hd_path path{};
+    for (auto token = std::next(tokens.begin()); token != tokens.end();
+        ++token)
+    {
+        auto digits = *token;
+        const auto hardened = !digits.empty() &&
+            is_hardened_marker(digits.back());
+
+        if (hardened)
+            digits.pop_back();
+
+        if (digits.empty() || digits.size() > 10)
+            return false;
+
+        uint64_t index{};
+        for (const auto digit: digits)
+        {
+            if (!is_ascii_number(digit))
+                return false;
+
+            index = index * 10u + static_cast<uint64_t>(digit - '0');
+        }
+
+        if (index >= hd_first_hardened_key)
+            return false;
+
+        path.push_back(narrow_cast<uint32_t>(hardened ?
+            index + hd_first_hardened_key : index));
+    }
+
+    out = std::move(path);
+    return true;
+}
+
+std::string encode_hd_path(const hd_path& path) NOEXCEPT
+{
+    std::string out{ "m" };
+    for (const auto index: path)
+    {
+        out += "/" + serialize(index & ~hd_first_hardened_key);
+        if (!is_zero(index & hd_first_hardened_key))
+            out += "'";
+    }
+
+    return out;
+}
+
+} // namespace wallet
+} // namespace system
+} // namespace libbitcoin
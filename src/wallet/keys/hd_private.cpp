@@ -173,7 +173,7 @@ hd_private hd_private::from_string(const std::string& encoded,
     uint32_t public_prefix) NOEXCEPT
 {
     hd_key key;
-    if (!decode_base58(key, encoded))
+    if (!decode_base58_checked(key, encoded))
         return {};
 
     return hd_private(from_key(key, public_prefix));
@@ -183,7 +183,7 @@ hd_private hd_private::from_string(const std::string& encoded,
     uint64_t prefixes) NOEXCEPT
 {
     hd_key key;
-    return decode_base58(key, encoded) ? hd_private(key, prefixes) :
+    return decode_base58_checked(key, encoded) ? hd_private(key, prefixes) :
         hd_private{};
 }
 
@@ -18,7 +18,9 @@
  */
 #include <bitcoin/system/wallet/keys/hd_public.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <string>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -107,7 +109,7 @@ hd_public hd_public::from_key(const hd_key& key) NOEXCEPT
 hd_public hd_public::from_string(const std::string& encoded) NOEXCEPT
 {
     hd_key key;
-    if (!decode_base58(key, encoded))
+    if (!decode_base58_checked(key, encoded))
         return {};
 
     return hd_public(from_key(key));
@@ -144,7 +146,7 @@ hd_public hd_public::from_string(const std::string& encoded,
     uint32_t prefix) NOEXCEPT
 {
     hd_key key;
-    if (!decode_base58(key, encoded))
+    if (!decode_base58_checked(key, encoded))
         return {};
 
     return hd_public(from_key(key, prefix));
@@ -235,6 +237,51 @@ hd_public hd_public::derive_public(uint32_t index) const NOEXCEPT
     return hd_public(child, intermediate.second, lineage);
 }
 
+compressed_list hd_public::derive_public_range(uint32_t first,
+    uint32_t count) const NOEXCEPT
+{
+    if (first >= hd_first_hardened_key || count > hd_first_hardened_key - first)
+        return {};
+
+    // The chain code is the hmac key for all children.
+    HMACSHA512CTX key;
+    HMACSHA512Init(&key, chain_.data(), chain_.size());
+
+    auto data = splice(point_, to_big_endian(first));
+    secret_list tweaks(count);
+
+    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
+    long_hash intermediate;
+    BC_POP_WARNING()
+
+    for (uint32_t offset = 0; offset < count; ++offset)
+    {
+        const auto index = to_big_endian(first + offset);
+        std::copy(index.begin(), index.end(),
+            std::next(data.begin(), ec_compressed_size));
+
+        auto context = key;
+        HMACSHA512Update(&context, data.data(), data.size());
+        HMACSHA512Final(&context, intermediate.data());
+
+        // The child key Ki is point(parse256(IL)) + Kpar.
+        tweaks[offset] = split(intermediate).first;
+    }
+
+    compressed_list children;
+    if (!ec_add(children, point_, tweaks))
+        return {};
+
+    return children;
+}
+
+short_hash_list hd_public::derive_short_hash_range(uint32_t first,
+    uint32_t count) const NOEXCEPT
+{
+    const auto children = derive_public_range(first, count);
+    return bitcoin_short_hashes({ children.begin(), children.end() });
+}
+
 // Helpers.
 // ----------------------------------------------------------------------------
 
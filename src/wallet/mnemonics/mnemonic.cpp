@@ -18,9 +18,11 @@
  */
 #include <bitcoin/system/wallet/mnemonics/mnemonic.hpp>
 
+#include <algorithm>
 /// DELETECSTDDEF
 /// DELETECSTDINT
 #include <string>
+#include <vector>
 /// DELETEMENOW
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
@@ -42,6 +44,43 @@ namespace wallet {
 static const auto index_bits = static_cast<uint8_t>(
     system::floored_log2(mnemonic::dictionary::size()));
 
+constexpr size_t hmac_iterations = 2048;
+constexpr auto passphrase_prefix = "mnemonic";
+
+// Checksums are hashed in batches of up to this many candidates.
+constexpr size_t validate_batch = 256;
+constexpr size_t maximum_buffer = add1(mnemonic::entropy_maximum);
+
+// Pack 11 bit word indexes into bytes (big-endian, high order bits first),
+// zero-padding the final byte. This is the base2048 word encoding.
+static bool pack_indexes(uint8_t* out, const size_t* indexes,
+    size_t count) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+    uint32_t accumulator = 0;
+    size_t bits = 0;
+    for (size_t word = 0; word < count; ++word)
+    {
+        const auto index = indexes[word];
+        if (index >= mnemonic::dictionary::size())
+            return false;
+
+        accumulator = (accumulator << index_bits) |
+            narrow_cast<uint32_t>(index);
+
+        for (bits += index_bits; bits >= byte_bits; bits -= byte_bits)
+            *out++ = narrow_cast<uint8_t>(accumulator >> (bits - byte_bits));
+
+        accumulator &= sub1(power2<uint32_t>(bits));
+    }
+
+    if (is_nonzero(bits))
+        *out = narrow_cast<uint8_t>(accumulator << (byte_bits - bits));
+
+    return true;
+    BC_POP_WARNING()
+}
+
 // private static
 // ----------------------------------------------------------------------------
 
@@ -91,9 +130,6 @@ data_chunk mnemonic::decoder(const string_list& words,
 long_hash mnemonic::seeder(const string_list& words,
     const std::string& passphrase) NOEXCEPT
 {
-    constexpr size_t hmac_iterations = 2048;
-    constexpr auto passphrase_prefix = "mnemonic";
-
     // Passphrase is limited to ascii (normal) if HAVE_ICU undefind.
     auto phrase = passphrase;
 
@@ -192,6 +228,107 @@ bool mnemonic::is_valid_word_count(size_t count) NOEXCEPT
         count >= word_minimum && count <= word_maximum);
 }
 
+bool mnemonic::validate(std::vector<bool>& valid,
+    const dictionary::search& candidates, size_t word_count) NOEXCEPT
+{
+    valid.clear();
+    if (!is_valid_word_count(word_count) ||
+        !is_zero(candidates.size() % word_count))
+        return false;
+
+    const auto count = candidates.size() / word_count;
+    const auto checksum = word_count / word_multiple;
+    const auto size = to_floored_bytes(word_count * index_bits - checksum);
+    const auto mask = max_uint8 << (byte_bits - checksum);
+    valid.resize(count);
+
+    // Entropy and checksum byte of each candidate in the batch.
+    std::array<std::array<uint8_t, maximum_buffer>, validate_batch> buffers;
+    std::array<const uint8_t*, validate_batch> pointers;
+    std::array<size_t, validate_batch> sizes;
+    std::array<hash_digest, validate_batch> hashes;
+    sizes.fill(size);
+
+    for (size_t first = 0; first < count; first += validate_batch)
+    {
+        const auto batch = std::min(validate_batch, count - first);
+        for (size_t index = 0; index < batch; ++index)
+        {
+            const auto offset = (first + index) * word_count;
+            if (!pack_indexes(buffers[index].data(), &candidates[offset],
+                word_count))
+            {
+                valid.clear();
+                return false;
+            }
+
+            pointers[index] = buffers[index].data();
+        }
+
+        intrinsics::sha256_multiple(hashes.front().data(), pointers.data(),
+            sizes.data(), batch);
+
+        // Checksum is in high order bits of the byte following entropy.
+        for (size_t index = 0; index < batch; ++index)
+            valid[first + index] = (hashes[index].front() & mask) ==
+                buffers[index][size];
+    }
+
+    return true;
+}
+
+bool mnemonic::to_seeds(long_hash_list& out,
+    const dictionary::search& candidates, size_t word_count,
+    language identifier, const std::string& passphrase) NOEXCEPT
+{
+    out.clear();
+    if (!is_valid_word_count(word_count) ||
+        !is_zero(candidates.size() % word_count) ||
+        !dictionaries_.exists(identifier))
+        return false;
+
+    const auto overflow = [](size_t index) NOEXCEPT
+    {
+        return index >= dictionary::size();
+    };
+
+    if (std::any_of(candidates.begin(), candidates.end(), overflow))
+        return false;
+
+    // Passphrase is normalized and salted once for all candidates.
+    auto phrase = passphrase;
+
+    LCOV_EXCL_START("Always succeeds unless HAVE_ICU undefined.")
+
+    if (!to_compatibility_decomposition(phrase))
+        return false;
+
+    LCOV_EXCL_STOP()
+
+    const auto salt = passphrase_prefix + phrase;
+    const auto seed = [&](size_t candidate) NOEXCEPT
+    {
+        const auto first = std::next(candidates.begin(),
+            candidate * word_count);
+
+        // Dictionary words are in normal form (as for entropy construction).
+        const auto words = dictionaries_.at({ first,
+            std::next(first, word_count) }, identifier);
+
+        return pkcs5_pbkdf2_hmac_sha512(system::join(words), salt,
+            hmac_iterations);
+    };
+
+    // Each candidate is 2048 rounds of hmac sha512, so parallelize by seed.
+    out.resize(candidates.size() / word_count);
+    parallel_for(out.size(), [&](size_t candidate) NOEXCEPT
+    {
+        out[candidate] = seed(candidate);
+    });
+
+    return true;
+}
+
 // construction
 // ----------------------------------------------------------------------------
 
@@ -24,7 +24,7 @@ namespace words {
 namespace electrum_v1 {
 
 // github.com/spesmilo/electrum/blob/master/electrum/old_mnemonic.py
-const catalog::words en
+constinit const catalog::words en = catalog::hashed(
 {
     false,
     {
@@ -1655,10 +1655,10 @@ const catalog::words en
         "weapon",
         "weary"
     }
-};
+});
 
 // github.com/spesmilo/electrum/blob/master/electrum/wordlist/portuguese.txt
-const catalog::words pt
+constinit const catalog::words pt = catalog::hashed(
 {
     false,
     {
@@ -3289,7 +3289,7 @@ const catalog::words pt
         "zenite",
         "zumbi"
     }
-};
+});
 
 } // namespace electrum_v1
 } // namespace words
@@ -26,7 +26,7 @@ namespace mnemonic {
 // BIP39 word lists from:
 // github.com/bitcoin/bips/blob/master/bip-0039/bip-0039-wordlists.md
 
-const catalog::words en
+constinit const catalog::words en = catalog::hashed(
 {
     true,
     {
@@ -2079,9 +2079,9 @@ const catalog::words en
         "zone",
         "zoo"
     }
-};
+});
 
-const catalog::words es
+constinit const catalog::words es = catalog::hashed(
 {
     false,
     {
@@ -4134,9 +4134,9 @@ const catalog::words es
         "zumo",
         "zurdo"
     }
-};
+});
 
-const catalog::words it
+constinit const catalog::words it = catalog::hashed(
 {
     true,
     {
@@ -6189,9 +6189,9 @@ const catalog::words it
         "zulu",
         "zuppa"
     }
-};
+});
 
-const catalog::words fr
+constinit const catalog::words fr = catalog::hashed(
 {
     false,
     {
@@ -8244,9 +8244,9 @@ const catalog::words fr
         "zeste",
         "zoologie"
     }
-};
+});
 
-const catalog::words cs
+constinit const catalog::words cs = catalog::hashed(
 {
     false,
     {
@@ -10299,9 +10299,9 @@ const catalog::words cs
         "zvukovod",
         "zvyk"
     }
-};
+});
 
-const catalog::words pt
+constinit const catalog::words pt = catalog::hashed(
 {
     true,
     {
@@ -12354,9 +12354,9 @@ const catalog::words pt
         "zoologia",
         "zumbido"
     }
-};
+});
 
-const catalog::words ja
+constinit const catalog::words ja = catalog::hashed(
 {
     false,
     {
@@ -14409,9 +14409,9 @@ const catalog::words ja
         "わらう",
         "われる"
     }
-};
+});
 
-const catalog::words ko
+constinit const catalog::words ko = catalog::hashed(
 {
     true,
     {
@@ -16464,9 +16464,9 @@ const catalog::words ko
         "흰색",
         "힘껏"
     }
-};
+});
 
-const catalog::words zh_Hans
+constinit const catalog::words zh_Hans = catalog::hashed(
 {
     false,
     {
@@ -18519,9 +18519,9 @@ const catalog::words zh_Hans
         "矮",
         "歇"
     }
-};
+});
 
-const catalog::words zh_Hant
+constinit const catalog::words zh_Hant = catalog::hashed(
 {
     false,
     {
@@ -20574,7 +20574,7 @@ const catalog::words zh_Hant
         "矮",
         "歇"
     }
-};
+});
 
 } // namespace mnemonic
 } // namespace words
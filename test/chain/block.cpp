@@ -126,6 +126,30 @@ public:
     {
         return block::is_unspent_coinbase_collision(height);
     }
+
+    bool is_overspent(size_t height, uint64_t subsidy_interval,
+        uint64_t initial_block_subsidy_satoshi, bool bip42,
+        const prevout_table& prevouts) const
+    {
+        return block::is_overspent(height, subsidy_interval,
+            initial_block_subsidy_satoshi, bip42, prevouts);
+    }
+
+    bool is_unspent_coinbase_collision(size_t height,
+        const prevout_table& prevouts) const
+    {
+        return block::is_unspent_coinbase_collision(height, prevouts);
+    }
+};
+
+static const accessor spending_block
+{
+    {},
+    {
+        { 1, inputs{ {} }, { output{ 50, script{} } }, 0 },
+        { 1, { { { hash1, 42 }, {}, 0 } }, { output{ 10, script{} } }, 0 },
+        { 1, { { { hash2, 27 }, {}, 0 }, { { hash3, 36 }, {}, 0 } }, {}, 0 }
+    }
 };
 
 // constructors
@@ -302,6 +326,51 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
     BOOST_REQUIRE_EQUAL(instance.hash(), instance.header().hash());
 }
 
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__expected_block__matches_transaction_hash)
+{
+    const auto hashes = expected_block.transaction_hashes(false);
+    BOOST_REQUIRE_EQUAL(hashes.size(), expected_transactions.size());
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], expected_transactions[index].hash(false));
+}
+
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__segregated_witness__null_coinbase_matches_transaction_hash)
+{
+    // Segregated coinbase, segregated spend and unsegregated spend.
+    const block instance
+    {
+        expected_header,
+        transactions
+        {
+            { 2, inputs{ { point{ null_hash, point::null_index }, script{}, witness{ "[0000000000000000000000000000000000000000000000000000000000000000]" }, 0 } }, { { 42, script{} } }, 0 },
+            { 2, inputs{ { point{ hash1, 0 }, script{}, witness{ "[242424] [424242]" }, 1 } }, { { 24, script{} } }, 0 },
+            { 1, inputs{ { point{ hash2, 1 }, script{}, witness{}, 2 } }, { { 12, script{} } }, 0 }
+        }
+    };
+
+    const auto& txs = *instance.transactions_ptr();
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE(txs[0]->is_coinbase());
+    BOOST_REQUIRE(txs[0]->is_segregated());
+    BOOST_REQUIRE(txs[1]->is_segregated());
+    BOOST_REQUIRE(!txs[2]->is_segregated());
+
+    const auto hashes = instance.transaction_hashes(true);
+    BOOST_REQUIRE_EQUAL(hashes.size(), txs.size());
+    BOOST_REQUIRE_EQUAL(hashes[0], null_hash);
+    BOOST_REQUIRE_NE(hashes[1], txs[1]->hash(false));
+
+    for (size_t index = 0; index < hashes.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], txs[index]->hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__default__empty)
+{
+    const block instance;
+    BOOST_REQUIRE(instance.transaction_hashes(true).empty());
+}
+
 // is_segregated
 // serialized_size
 
@@ -310,6 +379,45 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
 
 // check
 // accept
+
+BOOST_AUTO_TEST_CASE(block__accept__prevout_table_empty_block__matches_accept)
+{
+    const block instance;
+    const context state{};
+    const prevout_table prevouts{};
+    const auto expected = instance.accept(state, 210000, 50);
+    BOOST_REQUIRE_EQUAL(instance.accept(state, 210000, 50, prevouts), expected);
+    BOOST_REQUIRE_EQUAL(instance.accept(state, 210000, 50, prevouts, true), expected);
+}
+
+BOOST_AUTO_TEST_CASE(block__accept__prevout_table_from_transactions__matches_accept)
+{
+    const context state{};
+    const prevout_table prevouts{ *spending_block.transactions_ptr() };
+    const auto expected = spending_block.accept(state, 210000, 50);
+    BOOST_REQUIRE_EQUAL(spending_block.accept(state, 210000, 50, prevouts), expected);
+    BOOST_REQUIRE_EQUAL(spending_block.accept(state, 210000, 50, prevouts, true), expected);
+}
+
+BOOST_AUTO_TEST_CASE(block__accept__prevout_table_short__missing_previous_output)
+{
+    const context state{};
+    const prevout_table prevouts{ 3 };
+    BOOST_REQUIRE_EQUAL(spending_block.accept(state, 210000, 50, prevouts), error::missing_previous_output);
+}
+
+BOOST_AUTO_TEST_CASE(block__accept__prevout_table_found__success)
+{
+    const context state{ 0, 0, 0, 0, 100 };
+    prevout_table prevouts{};
+    prevouts.push_back(prevout_record{});
+    prevouts.push_back({ 20, 1, 0, 0, prevout_record::found });
+    prevouts.push_back({ 1, 1, 0, 0, prevout_record::found });
+    prevouts.push_back({ 2, 1, 0, 0, prevout_record::found });
+    BOOST_REQUIRE_EQUAL(spending_block.accept(state, 210000, 50, prevouts), error::block_success);
+    BOOST_REQUIRE_EQUAL(spending_block.accept(state, 210000, 50, prevouts, true), error::block_success);
+}
+
 // connect
 
 // validation (protected)
@@ -336,6 +444,30 @@ BOOST_AUTO_TEST_CASE(block__is_empty__single_transaction__false)
 // is_first_non_coinbase
 // is_extra_coinbases
 
+BOOST_AUTO_TEST_CASE(block__is_overspent__prevout_table__matches_prevouts)
+{
+    const prevout_table prevouts{ *spending_block.transactions_ptr() };
+    BOOST_REQUIRE_EQUAL(spending_block.is_overspent(0, 210000, 50, false, prevouts),
+        spending_block.is_overspent(0, 210000, 50, false));
+}
+
+BOOST_AUTO_TEST_CASE(block__is_overspent__prevout_table_fees__false)
+{
+    prevout_table prevouts{};
+    prevouts.push_back(prevout_record{});
+    prevouts.push_back({ 20, 0, 0, 0, prevout_record::found });
+    prevouts.push_back({ 1, 0, 0, 0, prevout_record::found });
+    prevouts.push_back({ 2, 0, 0, 0, prevout_record::found });
+    BOOST_REQUIRE(!spending_block.is_overspent(0, 210000, 50, false, prevouts));
+}
+
+BOOST_AUTO_TEST_CASE(block__is_unspent_coinbase_collision__prevout_table__matches_prevouts)
+{
+    const prevout_table prevouts{ *spending_block.transactions_ptr() };
+    BOOST_REQUIRE_EQUAL(spending_block.is_unspent_coinbase_collision(42, prevouts),
+        spending_block.is_unspent_coinbase_collision(42));
+}
+
 BOOST_AUTO_TEST_CASE(block__is_forward_reference__empty__false)
 {
     const accessor instance;
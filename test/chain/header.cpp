@@ -237,6 +237,47 @@ BOOST_AUTO_TEST_CASE(header__difficulty__genesis_block__expected)
     BOOST_REQUIRE_EQUAL(block.header().difficulty(), 0x0000000100010001);
 }
 
+// mining
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(header__find_nonce__mainnet_block_range__expected_nonce)
+{
+    const header instance
+    {
+        4,
+        base16_hash("000000000000000003ddc1e929e2944b8b0039af9aa0d826c480a83d8b39c373"),
+        base16_hash("a6cb0b0d6531a71abe2daaa4a991e5498e1b6b0b51549568d0f9d55329b905df"),
+        1474388414,
+        402972254,
+        0
+    };
+
+    uint32_t nonce{};
+    BOOST_REQUIRE(instance.find_nonce(nonce, 2842832236 - 50, 100));
+    BOOST_REQUIRE_EQUAL(nonce, 2842832236u);
+    BOOST_REQUIRE(!instance.find_nonce(nonce, 2842832236 + 1, 100));
+    BOOST_REQUIRE_EQUAL(nonce, 2842832236u);
+}
+
+BOOST_AUTO_TEST_CASE(header__find_nonce__regtest_bits__valid_proof_of_work)
+{
+    constexpr uint32_t regtest_bits = 0x207fffff;
+    const accessor instance{ 1, hash1, hash2, 1296688602, regtest_bits, 0 };
+
+    uint32_t nonce{};
+    BOOST_REQUIRE(instance.find_nonce(nonce));
+
+    const accessor mined{ 1, hash1, hash2, 1296688602, regtest_bits, nonce };
+    BOOST_REQUIRE(!mined.is_invalid_proof_of_work(regtest_bits, false));
+}
+
+BOOST_AUTO_TEST_CASE(header__find_nonce__zero_bits__false)
+{
+    const header instance{ 1, hash1, hash2, 1296688602, 0, 0 };
+    uint32_t nonce{};
+    BOOST_REQUIRE(!instance.find_nonce(nonce));
+}
+
 // validation (public)
 // ----------------------------------------------------------------------------
 
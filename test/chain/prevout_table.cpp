@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(prevout_table_tests)
+
+using namespace system::chain;
+
+constexpr auto found = prevout_record::found;
+constexpr auto spent = prevout_record::spent;
+constexpr auto coinbase = prevout_record::coinbase;
+
+// constructors
+
+BOOST_AUTO_TEST_CASE(prevout_table__constructor__default__empty)
+{
+    const prevout_table instance;
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__constructor__count__empty)
+{
+    const prevout_table instance(42);
+    BOOST_REQUIRE(instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__constructor__transactions__all_inputs_in_order)
+{
+    const input input0{ { hash_digest{}, 0 }, {}, 0 };
+    const input input1{ { hash_digest{}, 1 }, {}, 0 };
+    const input input2{ { hash_digest{}, 2 }, {}, 0 };
+    *input0.prevout = { 10, script{} };
+    *input1.prevout = { 11, script{} };
+    *input2.prevout = { 12, script{} };
+    input2.prevout->height = 42;
+
+    const transaction_ptrs txs
+    {
+        to_shared(transaction{ 0, inputs{ input0 }, outputs{}, 0 }),
+        to_shared(transaction{ 0, inputs{ input1, input2 }, outputs{}, 0 })
+    };
+
+    const prevout_table instance(txs);
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.at(0).value, 10u);
+    BOOST_REQUIRE_EQUAL(instance.at(1).value, 11u);
+    BOOST_REQUIRE_EQUAL(instance.at(2).value, 12u);
+    BOOST_REQUIRE_EQUAL(instance.at(2).height, 42u);
+}
+
+// push_back
+
+BOOST_AUTO_TEST_CASE(prevout_table__push_back__default_prevout__default_record)
+{
+    prevout_table instance;
+    instance.push_back(prevout{});
+    const prevout_record expected{};
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.at(0).height, expected.height);
+    BOOST_REQUIRE_EQUAL(instance.at(0).median_time_past, expected.median_time_past);
+    BOOST_REQUIRE_EQUAL(instance.at(0).flags, expected.flags);
+    BOOST_REQUIRE(instance.is_missing(0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__push_back__prevout__expected_record)
+{
+    prevout value{ 42, script{} };
+    value.height = 7;
+    value.median_time_past = 9;
+    value.spent = false;
+    value.coinbase = true;
+
+    prevout_table instance;
+    instance.push_back(value);
+    const auto record = instance.at(0);
+    BOOST_REQUIRE_EQUAL(record.value, 42u);
+    BOOST_REQUIRE_EQUAL(record.height, 7u);
+    BOOST_REQUIRE_EQUAL(record.median_time_past, 9u);
+    BOOST_REQUIRE_EQUAL(record.flags, bit_or(found, coinbase));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__push_back__record__expected_columns)
+{
+    prevout_table instance;
+    instance.push_back({ 1, 2, 3, 4, found });
+    instance.push_back({ 5, 6, 7, 8, spent });
+    BOOST_REQUIRE_EQUAL(instance.values()[1], 5u);
+    BOOST_REQUIRE_EQUAL(instance.heights()[1], 6u);
+    BOOST_REQUIRE_EQUAL(instance.median_times_past()[1], 7u);
+    BOOST_REQUIRE_EQUAL(instance.script_offsets()[1], 8u);
+    BOOST_REQUIRE_EQUAL(instance.flags()[1], spent);
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__clear__populated__empty)
+{
+    prevout_table instance;
+    instance.push_back(prevout_record{});
+    instance.clear();
+    BOOST_REQUIRE(instance.empty());
+}
+
+// is_missing
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_missing__empty_range__false)
+{
+    prevout_table instance;
+    instance.push_back(prevout_record{});
+    BOOST_REQUIRE(!instance.is_missing(0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_missing__found_and_missing__true)
+{
+    prevout_table instance;
+    instance.push_back({ 1, 1, 1, 0, found });
+    instance.push_back({ 1, 1, 1, 0, spent });
+    BOOST_REQUIRE(!instance.is_missing(0, 1));
+    BOOST_REQUIRE(instance.is_missing(0, 2));
+    BOOST_REQUIRE(instance.is_missing(1, 1));
+}
+
+// value
+
+BOOST_AUTO_TEST_CASE(prevout_table__value__range__sum)
+{
+    prevout_table instance;
+    instance.push_back({ 1, 0, 0, 0, found });
+    instance.push_back({ 2, 0, 0, 0, found });
+    instance.push_back({ 4, 0, 0, 0, found });
+    BOOST_REQUIRE_EQUAL(instance.value(0, 3), 7u);
+    BOOST_REQUIRE_EQUAL(instance.value(1, 2), 6u);
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__value__overflow__max_uint64)
+{
+    prevout_table instance;
+    instance.push_back({ max_uint64, 0, 0, 0, found });
+    instance.push_back({ 1, 0, 0, 0, found });
+    BOOST_REQUIRE_EQUAL(instance.value(0, 2), max_uint64);
+}
+
+// is_immature
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_immature__genesis_coinbase__true)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 0, 0, 0, bit_or(found, coinbase) });
+    BOOST_REQUIRE(instance.is_immature(0, 1, coinbase_maturity));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_immature__premature_coinbase__true)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 1, 0, 0, bit_or(found, coinbase) });
+    BOOST_REQUIRE(instance.is_immature(0, 1, coinbase_maturity));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_immature__mature_coinbase__false)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 1, 0, 0, bit_or(found, coinbase) });
+    BOOST_REQUIRE(!instance.is_immature(0, 1, add1(coinbase_maturity)));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_immature__premature_non_coinbase__false)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 1, 0, 0, found });
+    BOOST_REQUIRE(!instance.is_immature(0, 1, coinbase_maturity));
+}
+
+// is_locked
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_locked__block_relative_lock__expected)
+{
+    const input_cptrs inputs{ to_shared(input{ point{}, script{}, 10 }) };
+    prevout_table instance;
+    instance.push_back({ 0, 100, 0, 0, found });
+    BOOST_REQUIRE(instance.is_locked(0, inputs, 109, 0));
+    BOOST_REQUIRE(!instance.is_locked(0, inputs, 110, 0));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_locked__disabled__false)
+{
+    const input_cptrs inputs{ to_shared(input{ point{}, script{}, max_uint32 }) };
+    prevout_table instance;
+    instance.push_back({ 0, 100, 0, 0, found });
+    BOOST_REQUIRE(!instance.is_locked(0, inputs, 100, 0));
+}
+
+// is_unconfirmed_spend
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_unconfirmed_spend__zero_height__true)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 0, 0, 0, found });
+    BOOST_REQUIRE(instance.is_unconfirmed_spend(0, 1, 0));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_unconfirmed_spend__confirmed__false)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 1, 0, 0, found });
+    BOOST_REQUIRE(!instance.is_unconfirmed_spend(0, 1, 42));
+}
+
+// is_confirmed_double_spend
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_confirmed_double_spend__spent__true)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 0, 0, 0, bit_or(found, spent) });
+    BOOST_REQUIRE(instance.is_confirmed_double_spend(0, 1, 42));
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__is_confirmed_double_spend__unspent__false)
+{
+    prevout_table instance;
+    instance.push_back({ 0, 0, 0, 0, found });
+    BOOST_REQUIRE(!instance.is_confirmed_double_spend(0, 1, 42));
+}
+
+// transaction::accept
+
+BOOST_AUTO_TEST_CASE(prevout_table__transaction_accept__missing_prevout__missing_previous_output)
+{
+    const input input{ { one_hash, 0 }, {}, 0 };
+    const transaction tx{ 0, inputs{ input }, outputs{}, 0 };
+    const prevout_table prevouts{ transaction_ptrs{ to_shared(tx) } };
+
+    const context state{};
+    BOOST_REQUIRE_EQUAL(tx.accept(state), error::missing_previous_output);
+    BOOST_REQUIRE_EQUAL(tx.accept(state, prevouts, 0), error::missing_previous_output);
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__transaction_accept__overspent__spend_exceeds_value)
+{
+    const input input{ { one_hash, 0 }, {}, 0 };
+    const transaction tx{ 0, inputs{ input }, outputs{ { 42, script{} } }, 0 };
+
+    prevout_table prevouts;
+    prevouts.push_back({ 41, 1, 0, 0, found });
+    const context state{};
+    BOOST_REQUIRE_EQUAL(tx.accept(state, prevouts, 0), error::spend_exceeds_value);
+}
+
+BOOST_AUTO_TEST_CASE(prevout_table__transaction_accept__offset_valid__success)
+{
+    const input input{ { one_hash, 0 }, {}, 0 };
+    const transaction tx{ 0, inputs{ input }, outputs{ { 42, script{} } }, 0 };
+
+    prevout_table prevouts;
+    prevouts.push_back(prevout_record{});
+    prevouts.push_back({ 42, 1, 0, 0, found });
+    const context state{ 0, 0, 0, 0, 42 };
+    BOOST_REQUIRE_EQUAL(tx.accept(state, prevouts, 1), error::transaction_success);
+    BOOST_REQUIRE_EQUAL(tx.accept(state, prevouts, 0), error::missing_previous_output);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1429,6 +1429,132 @@ BOOST_AUTO_TEST_CASE(transaction__create_endorsement__single_input_no_output__ex
     BOOST_REQUIRE_EQUAL(out, expected);
 }
 
+// create_endorsements
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__empty__true_empty)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    endorsements out(3);
+    BOOST_REQUIRE(test_tx.create_endorsements(out, {}, false));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__invalid_index__false)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    const auto prevout_script = to_shared(script{ std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" } });
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const transaction::signers signers
+    {
+        { secret, prevout_script, 0, 0, coverage::hash_all, script_version::unversioned },
+        { secret, prevout_script, 1, 0, coverage::hash_all, script_version::unversioned }
+    };
+
+    endorsements out;
+    BOOST_REQUIRE(!test_tx.create_endorsements(out, signers, false));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__null_script__false)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const transaction::signers signers
+    {
+        { secret, nullptr, 0, 0, coverage::hash_all, script_version::unversioned }
+    };
+
+    endorsements out;
+    BOOST_REQUIRE(!test_tx.create_endorsements(out, signers, false));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__deterministic__expected)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    const auto prevout_script = to_shared(script{ std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" } });
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const transaction::signers signers
+    {
+        { secret, prevout_script, 0, 0, coverage::hash_all, script_version::unversioned },
+        { secret, prevout_script, 0, 0, coverage::hash_all, script_version::unversioned }
+    };
+
+    // Existing storage is reused (and overwritten).
+    endorsements out{ base16_chunk("deadbeef") };
+    BOOST_REQUIRE(test_tx.create_endorsements(out, signers, false));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+
+    const auto expected = base16_chunk("3045022100e428d3cc67a724cb6cfe8634aa299e58f189d9c46c02641e936c40cc16c7e8ed0220083949910fe999c21734a1f33e42fca15fb463ea2e08f0a1bccd952aacaadbb801");
+    BOOST_REQUIRE_EQUAL(out[0], expected);
+    BOOST_REQUIRE_EQUAL(out[1], expected);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__version_0__matches_create_endorsement)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    const auto prevout_script = to_shared(script{ std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" } });
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const auto value = 100000u;
+    const auto bip143 = true;
+    const transaction::signers signers
+    {
+        { secret, prevout_script, 0, value, coverage::hash_all, script_version::zero },
+        { secret, prevout_script, 0, value, coverage::hash_single, script_version::zero }
+    };
+
+    endorsement all;
+    endorsement single;
+    BOOST_REQUIRE(test_tx.create_endorsement(all, secret, *prevout_script, 0, value, coverage::hash_all, script_version::zero, bip143));
+    BOOST_REQUIRE(test_tx.create_endorsement(single, secret, *prevout_script, 0, value, coverage::hash_single, script_version::zero, bip143));
+
+    endorsements out;
+    BOOST_REQUIRE(test_tx.create_endorsements(out, signers, bip143));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out[0], all);
+    BOOST_REQUIRE_EQUAL(out[1], single);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__create_endorsements__hedged__valid_signature)
+{
+    const auto tx_data = base16_chunk("0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000");
+    const transaction test_tx(tx_data, true);
+    BOOST_REQUIRE(test_tx.is_valid());
+
+    const auto prevout_script = to_shared(script{ std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" } });
+    const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+    const transaction::signers signers
+    {
+        { secret, prevout_script, 0, 0, coverage::hash_all, script_version::unversioned }
+    };
+
+    endorsements out;
+    BOOST_REQUIRE(test_tx.create_endorsements(out, signers, false, false));
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out[0].back(), coverage::hash_all);
+
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    ec_signature signature;
+    const data_chunk der(out[0].begin(), std::prev(out[0].end()));
+    BOOST_REQUIRE(parse_signature(signature, der, true));
+    BOOST_REQUIRE(test_tx.check_signature(signature, point, *prevout_script, 0, 0, coverage::hash_all, script_version::unversioned, false));
+}
+
 // signature_hash
 
 BOOST_AUTO_TEST_CASE(transaction__signature_hash__all__expected)
@@ -183,6 +183,28 @@ BOOST_AUTO_TEST_CASE(checksum__verify_checksum_array__invalidated__false)
     BOOST_REQUIRE(!verify_checksum(data));
 }
 
+// decode_base58_checked
+
+BOOST_AUTO_TEST_CASE(checksum__decode_base58_checked__address__true_expected)
+{
+    const auto expected = base16_array("005cc87f4a3fdfe3a2346b6953267ca867282630d3f9b78e64");
+    data_array<25> out;
+    BOOST_REQUIRE(decode_base58_checked(out, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+    BOOST_REQUIRE_EQUAL(out, expected);
+}
+
+BOOST_AUTO_TEST_CASE(checksum__decode_base58_checked__invalid_checksum__false)
+{
+    data_array<25> out;
+    BOOST_REQUIRE(!decode_base58_checked(out, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViU"));
+}
+
+BOOST_AUTO_TEST_CASE(checksum__decode_base58_checked__wrong_size__false)
+{
+    data_array<24> out;
+    BOOST_REQUIRE(!decode_base58_checked(out, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+}
+
 // verify_checksum
 
 BOOST_AUTO_TEST_CASE(checksum__verify_checksum_slice__underflow__false)
@@ -353,4 +375,24 @@ BOOST_AUTO_TEST_CASE(checksum__bech32_verify_checked__invalid_checksum__false)
     BOOST_REQUIRE(!bech32_verify_checked(out_version, out_program, bip173_testnet_prefix, checked));
 }
 
+BOOST_AUTO_TEST_CASE(checksum__bech32_polymod__streamed__matches_checked)
+{
+    const auto program = base16_chunk("751e76e8199196d454941c45d1b3a323f1433bd6");
+    const auto checked = bech32_build_checked(0, program, "bc");
+    BOOST_REQUIRE(!checked.empty());
+
+    auto checksum = bech32_prefix_polymod("bc");
+    for (const auto& value: checked)
+        checksum = bech32_polymod(checksum, value.convert_to<uint8_t>());
+
+    BOOST_REQUIRE_EQUAL(checksum, bech32_constant(0));
+}
+
+BOOST_AUTO_TEST_CASE(checksum__bech32_constant__versions__bech32_bech32m)
+{
+    BOOST_REQUIRE_EQUAL(bech32_constant(0), 0x00000001u);
+    BOOST_REQUIRE_EQUAL(bech32_constant(1), 0x2bc830a3u);
+    BOOST_REQUIRE_EQUAL(bech32_constant(16), 0x2bc830a3u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
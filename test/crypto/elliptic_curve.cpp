@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include <atomic>
+#include <thread>
 
 BOOST_AUTO_TEST_SUITE(elliptic_curve_tests)
 
@@ -84,6 +86,62 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__uncompressed_positive__ex
     BOOST_REQUIRE_EQUAL(point, uncompressed1);
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__list__expected)
+{
+    compressed_list points;
+    BOOST_REQUIRE(secret_to_public(points, { secret1, one }));
+    BOOST_REQUIRE_EQUAL(points.size(), 2u);
+    BOOST_REQUIRE_EQUAL(points[0], compressed1);
+    BOOST_REQUIRE_EQUAL(points[1], ec_compressed_generator);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public__list_null_secret__false)
+{
+    compressed_list points;
+    BOOST_REQUIRE(!secret_to_public(points, { secret1, null_hash }));
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public_range__one__generator_multiples)
+{
+    compressed_list points;
+    BOOST_REQUIRE(secret_to_public_range(points, one, 4));
+    BOOST_REQUIRE_EQUAL(points.size(), 4u);
+    BOOST_REQUIRE_EQUAL(points[0], ec_compressed_generator);
+    BOOST_REQUIRE_EQUAL(points[3], generator_point_times_4);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public_range__chunks__expected)
+{
+    // Spans multiple chunks, each started by its own multiplication.
+    compressed_list points;
+    BOOST_REQUIRE(secret_to_public_range(points, secret1, 2500));
+    BOOST_REQUIRE_EQUAL(points.size(), 2500u);
+
+    auto secret = secret1;
+    ec_compressed expected;
+    for (const auto& point: points)
+    {
+        BOOST_REQUIRE(secret_to_public(expected, secret));
+        BOOST_REQUIRE_EQUAL(point, expected);
+        BOOST_REQUIRE(ec_add(secret, one));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public_range__empty__true_empty)
+{
+    compressed_list points;
+    BOOST_REQUIRE(secret_to_public_range(points, secret1, 0));
+    BOOST_REQUIRE(points.empty());
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__secret_to_public_range__order_wrap__false)
+{
+    // The curve order minus one, followed by zero (invalid).
+    const ec_secret last = base16_array("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140");
+    compressed_list points;
+    BOOST_REQUIRE(!secret_to_public_range(points, last, 2));
+}
+
 // signature
 
 BOOST_AUTO_TEST_CASE(elliptic_curve__sign__positive__expected)
@@ -93,6 +151,31 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__sign__positive__expected)
     BOOST_REQUIRE_EQUAL(signature, signature3);
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__sign__rerandomized_threads__expected)
+{
+    // Signing is deterministic, so periodic (per thread) context blinding
+    // must not change signatures. Each thread crosses the 1024 use interval.
+    const auto test = [](std::atomic_bool& success)
+    {
+        for (size_t use = 0; use < 2500u; ++use)
+        {
+            ec_signature signature;
+            if (!sign(signature, secret3, sighash3) || signature != signature3)
+            {
+                success = false;
+                return;
+            }
+        }
+    };
+
+    std::atomic_bool success{ true };
+    std::thread first{ test, std::ref(success) };
+    std::thread second{ test, std::ref(success) };
+    first.join();
+    second.join();
+    BOOST_REQUIRE(success);
+}
+
 BOOST_AUTO_TEST_CASE(elliptic_curve__encode_signature__positive__expected)
 {
     der_signature signature;
@@ -211,4 +294,88 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__ec_multiply__expected)
     BOOST_REQUIRE_EQUAL(public1, public2);
 }
 
+// signing context
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_randomize_context__sign__unchanged)
+{
+    const auto hash = bitcoin_hash(to_chunk("data"));
+
+    ec_signature expected;
+    BOOST_REQUIRE(sign(expected, secret1, hash));
+    BOOST_REQUIRE(ec_randomize_context());
+
+    ec_signature signature;
+    BOOST_REQUIRE(sign(signature, secret1, hash));
+    BOOST_REQUIRE_EQUAL(signature, expected);
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_release_context__recreated__unchanged)
+{
+    const auto hash = bitcoin_hash(to_chunk("data"));
+
+    ec_compressed expected_point;
+    ec_signature expected_signature;
+    BOOST_REQUIRE(secret_to_public(expected_point, secret1));
+    BOOST_REQUIRE(sign(expected_signature, secret1, hash));
+
+    // Released contexts are recreated on next use, repeatedly.
+    ec_release_context();
+    ec_release_context();
+
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret1));
+    BOOST_REQUIRE_EQUAL(point, expected_point);
+
+    ec_release_context();
+
+    ec_signature signature;
+    BOOST_REQUIRE(sign(signature, secret1, hash));
+    BOOST_REQUIRE_EQUAL(signature, expected_signature);
+    BOOST_REQUIRE(verify_signature(point, hash, signature));
+
+    // Randomization of a released context recreates it.
+    ec_release_context();
+    BOOST_REQUIRE(ec_randomize_context());
+    BOOST_REQUIRE(sign(signature, secret1, hash));
+    BOOST_REQUIRE_EQUAL(signature, expected_signature);
+}
+
+static size_t entropy_calls{};
+static bool failing_entropy(const data_slab&) NOEXCEPT
+{
+    ++entropy_calls;
+    return false;
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_randomize_context__failing_source__deferred_to_interval)
+{
+    const auto hash = bitcoin_hash(to_chunk("data"));
+
+    ec_signature expected;
+    BOOST_REQUIRE(sign(expected, secret1, hash));
+
+    // A failed refresh leaves the context usable and restarts the (1024 use)
+    // refresh interval.
+    entropy_calls = 0;
+    BOOST_REQUIRE(!ec_randomize_context(&failing_entropy));
+    BOOST_REQUIRE_EQUAL(entropy_calls, 1u);
+
+    ec_signature signature;
+    for (size_t use = 1; use < 1024; ++use)
+        BOOST_REQUIRE(sign(signature, secret1, hash));
+
+    BOOST_REQUIRE_EQUAL(entropy_calls, 1u);
+    BOOST_REQUIRE_EQUAL(signature, expected);
+
+    // The next refresh is attempted only at the interval.
+    BOOST_REQUIRE(sign(signature, secret1, hash));
+    BOOST_REQUIRE_EQUAL(entropy_calls, 2u);
+    BOOST_REQUIRE_EQUAL(signature, expected);
+
+    // Release restores the default source.
+    ec_release_context();
+    BOOST_REQUIRE(ec_randomize_context());
+    BOOST_REQUIRE_EQUAL(entropy_calls, 2u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
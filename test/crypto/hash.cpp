@@ -47,6 +47,26 @@ BOOST_AUTO_TEST_CASE(hash__sripemd160_hash__ripemd_tests__expected)
     BOOST_REQUIRE_EQUAL(encode_base16(ripemd_hash2), "c23e37c6fad06deab545f952992c8f28cb02bbe5");
 }
 
+BOOST_AUTO_TEST_CASE(hash__bitcoin_short_hashes__empty__empty)
+{
+    BOOST_REQUIRE(bitcoin_short_hashes({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(hash__bitcoin_short_hashes__public_keys__expected)
+{
+    const auto key = base16_array("020641fde3a85beb8321033516de7ec01c35de96e945bf76c3768784a905471986");
+    const auto value = to_array(110);
+    const std::vector<data_slice> data(9, key);
+    auto mixed = data;
+    mixed[4] = value;
+
+    const auto hashes = bitcoin_short_hashes(mixed);
+    BOOST_REQUIRE_EQUAL(hashes.size(), 9u);
+    BOOST_REQUIRE_EQUAL(encode_base16(hashes[0]), "c23e37c6fad06deab545f952992c8f28cb02bbe5");
+    BOOST_REQUIRE_EQUAL(encode_base16(hashes[4]), "17d040b739d639c729daaf627eaff88cfe4207f4");
+    BOOST_REQUIRE_EQUAL(encode_base16(hashes[8]), "c23e37c6fad06deab545f952992c8f28cb02bbe5");
+}
+
 BOOST_AUTO_TEST_CASE(hash__sha256_hash__data__expected)
 {
     const data_chunk chunk{ 'd', 'a', 't', 'a' };
@@ -112,6 +132,54 @@ BOOST_AUTO_TEST_CASE(hash__djb2_hash__01234567890abcdefghijklmnopqrstuvwxyz__0xe
     BOOST_REQUIRE_EQUAL(static_cast<uint32_t>(hash), 0xe1669c01);
 }
 
+// array_hash
+
+BOOST_AUTO_TEST_CASE(hash__array_hash__same_value__same_hash)
+{
+    const auto value = sha256_hash("abc");
+    BOOST_REQUIRE_EQUAL(array_hash(value), array_hash(sha256_hash("abc")));
+}
+
+BOOST_AUTO_TEST_CASE(hash__array_hash__distinct_values__distinct_hashes)
+{
+    BOOST_REQUIRE_NE(array_hash(null_hash), array_hash(one_hash));
+    BOOST_REQUIRE_NE(array_hash(sha256_hash("abc")), array_hash(sha256_hash("abd")));
+}
+
+BOOST_AUTO_TEST_CASE(hash__array_hash__distinct_tail_bytes__distinct_hashes)
+{
+    // 20 bytes is two words and a four byte tail.
+    auto value = null_short_hash;
+    const auto initial = array_hash(value);
+    value.back() = 1;
+    BOOST_REQUIRE_NE(array_hash(value), initial);
+}
+
+BOOST_AUTO_TEST_CASE(hash__array_hash__distinct_sizes__distinct_hashes)
+{
+    BOOST_REQUIRE_NE(array_hash(null_half_hash), array_hash(null_hash));
+}
+
+BOOST_AUTO_TEST_CASE(hash__array_hash__salted__distinct_hash)
+{
+    const auto value = sha256_hash("abc");
+    BOOST_REQUIRE_NE(array_hash(value, 42), array_hash(value));
+}
+
+BOOST_AUTO_TEST_CASE(hash__array_hash__std_hash__expected)
+{
+    const auto value = sha256_hash("abc");
+    BOOST_REQUIRE_EQUAL(std::hash<hash_digest>{}(value), array_hash(value));
+    BOOST_REQUIRE_EQUAL(boost::hash<hash_digest>{}(value), array_hash(value));
+}
+
+BOOST_AUTO_TEST_CASE(hash__salted_array_hash__hash_salt__expected)
+{
+    const auto value = sha256_hash("abc");
+    BOOST_REQUIRE_EQUAL(hash_salt(), hash_salt());
+    BOOST_REQUIRE_EQUAL(salted_array_hash{}(value), array_hash(value, hash_salt()));
+}
+
 // hash_reduce
 
 hash_digest to_merkle_root(const hash_list& hashes)
@@ -18,11 +18,24 @@
  */
 #include "../../test.hpp"
 /// DELETECSTDINT
+#include <atomic>
+#include <thread>
 
 BOOST_AUTO_TEST_SUITE(intrinsics_tests)
 
 using namespace bc::system::intrinsics;
 
+// The kernel family is process wide, so restore it for subsequent tests.
+struct kernel_guard
+{
+    ~kernel_guard()
+    {
+        set_kernel(family);
+    }
+
+    const kernel family{ get_kernel() };
+};
+
 // "try" tests not reliable across platforms.
 // These have all been moved into cpp (no longer public).
 
@@ -85,4 +98,288 @@ BOOST_AUTO_TEST_CASE(intrinsics__sha256_paired_double__vs_sha256x2__same)
         BOOST_REQUIRE_EQUAL(memcmp(out1, out2, 32 * i), 0);
     }
 }
+
+BOOST_AUTO_TEST_CASE(intrinsics__sha256_single__consecutive_blocks__vs_portable__same)
+{
+    uint8_t in[64 * 9]{};
+    for (size_t j = 0; j < sizeof(in); ++j)
+        in[j] = static_cast<uint8_t>(j * 7 + 3);
+
+    auto expected = sha256_initial;
+    auto actual = sha256_initial;
+
+    for (size_t j = 0; j < 9; ++j)
+    {
+        sha256_x1_portable(expected.data(), in + 64 * j);
+        sha256_single(actual.data(), in + 64 * j);
+        BOOST_REQUIRE(actual == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__sha512_single__consecutive_blocks__vs_portable__same)
+{
+    uint8_t in[128 * 5]{};
+    for (size_t j = 0; j < sizeof(in); ++j)
+        in[j] = static_cast<uint8_t>(j * 11 + 7);
+
+    auto expected = sha512_initial;
+    auto actual = sha512_initial;
+
+    for (size_t j = 0; j < 5; ++j)
+    {
+        sha512_x1_portable(expected.data(), in + 128 * j);
+        sha512_single(actual.data(), in + 128 * j);
+        BOOST_REQUIRE(actual == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__set_kernel__portable__same_hashes)
+{
+    uint8_t in[64 * 9]{};
+    for (size_t j = 0; j < sizeof(in); ++j)
+        in[j] = static_cast<uint8_t>(j * 5 + 1);
+
+    const kernel_guard guard{};
+    uint8_t expected[32 * 9]{};
+    sha256_paired_double(expected, in, 9);
+
+    uint8_t actual[32 * 9]{};
+    BOOST_REQUIRE(set_kernel(kernel::portable));
+    BOOST_REQUIRE(get_kernel() == kernel::portable);
+    sha256_paired_double(actual, in, 9);
+    BOOST_REQUIRE_EQUAL(memcmp(actual, expected, sizeof(actual)), 0);
+
+    BOOST_REQUIRE(set_kernel(guard.family));
+    BOOST_REQUIRE(get_kernel() == guard.family);
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__set_kernel__while_hashing__same_hashes)
+{
+    const kernel_guard guard{};
+    uint8_t in[64 * 19]{};
+    for (size_t j = 0; j < sizeof(in); ++j)
+        in[j] = static_cast<uint8_t>(j * 7 + 5);
+
+    uint8_t expected[32 * 19]{};
+    for (size_t j = 0; j < 19; ++j)
+        double_sha256_x1_portable(expected + 32 * j, in + 64 * j);
+
+    std::atomic_bool done{ false };
+    std::atomic_bool success{ true };
+    std::thread hasher{ [&]()
+    {
+        uint8_t actual[32 * 19]{};
+        while (!done)
+        {
+            sha256_paired_double(actual, in, 19);
+            if (memcmp(actual, expected, sizeof(actual)) != 0)
+                success = false;
+        }
+    } };
+
+    for (size_t round = 0; round < 100; ++round)
+    {
+        set_kernel(kernel::portable);
+        set_kernel(kernel::automatic);
+    }
+
+    done = true;
+    hasher.join();
+    BOOST_REQUIRE(success);
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__set_kernel__each_family__single_vs_portable__same)
+{
+    uint8_t in[128 * 5]{};
+    for (size_t j = 0; j < sizeof(in); ++j)
+        in[j] = static_cast<uint8_t>(j * 13 + 11);
+
+    const kernel_guard guard{};
+    for (const auto pinned: { kernel::automatic, kernel::portable,
+        kernel::shani, kernel::avx512, kernel::avx2, kernel::sse41,
+        kernel::neon, kernel::sse4 })
+    {
+        if (!set_kernel(pinned))
+            continue;
+
+        auto expected = sha256_initial;
+        auto actual = sha256_initial;
+        auto expected512 = sha512_initial;
+        auto actual512 = sha512_initial;
+
+        for (size_t j = 0; j < 5; ++j)
+        {
+            sha256_x1_portable(expected.data(), in + 128 * j);
+            sha256_single(actual.data(), in + 128 * j);
+            sha512_x1_portable(expected512.data(), in + 128 * j);
+            sha512_single(actual512.data(), in + 128 * j);
+        }
+
+        BOOST_REQUIRE(get_kernel() == pinned);
+        BOOST_REQUIRE(actual == expected);
+        BOOST_REQUIRE(actual512 == expected512);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__set_kernel__avx512__paired_and_multiple_vs_portable__same)
+{
+    const kernel_guard guard{};
+    if (!set_kernel(kernel::avx512))
+        return;
+
+    // Spans full 16 lane sets and partial remainders.
+    constexpr size_t blocks = 37;
+    uint8_t in[64 * blocks]{};
+    for (size_t j = 0; j < sizeof(in); ++j)
+        in[j] = static_cast<uint8_t>(j * 3 + 1);
+
+    const uint8_t* messages[blocks]{};
+    size_t sizes[blocks]{};
+    for (size_t j = 0; j < blocks; ++j)
+    {
+        messages[j] = in + j;
+        sizes[j] = j * 29 % (sizeof(in) - blocks);
+    }
+
+    uint8_t paired[32 * blocks]{};
+    uint8_t multiple[32 * blocks]{};
+    sha256_paired_double(paired, in, blocks);
+    sha256_multiple(multiple, messages, sizes, blocks);
+
+    uint8_t expected_paired[32 * blocks]{};
+    uint8_t expected_multiple[32 * blocks]{};
+    for (size_t j = 0; j < blocks; ++j)
+    {
+        double_sha256_x1_portable(expected_paired + 32 * j, in + 64 * j);
+        sha256(messages[j], sizes[j], expected_multiple + 32 * j);
+    }
+
+    BOOST_REQUIRE_EQUAL(memcmp(paired, expected_paired, sizeof(paired)), 0);
+    BOOST_REQUIRE_EQUAL(memcmp(multiple, expected_multiple, sizeof(multiple)), 0);
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__sha256_multiple__varied_sizes__vs_sha256__same)
+{
+    // Sizes span empty, one and two pad blocks, and unbalanced lanes.
+    constexpr size_t count = 19;
+    const size_t sizes[count]{ 0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 1000,
+        3, 200, 31, 32, 33, 300, 17, 2 };
+
+    data_chunk data(1000 + 1);
+    for (size_t j = 0; j < data.size(); ++j)
+        data[j] = static_cast<uint8_t>(j);
+
+    const uint8_t* in[count]{};
+    for (size_t j = 0; j < count; ++j)
+        in[j] = data.data() + j;
+
+    uint8_t out1[32 * count]{};
+    uint8_t out2[32 * count]{};
+    for (size_t j = 0; j < count; ++j)
+        sha256(in[j], sizes[j], out1 + 32 * j);
+
+    sha256_multiple(out2, in, sizes, count);
+    BOOST_REQUIRE_EQUAL(memcmp(out1, out2, 32 * count), 0);
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__double_sha256_multiple__varied_sizes__vs_bitcoin_hash__same)
+{
+    for (size_t count = 0; count <= 17; ++count)
+    {
+        std::vector<data_chunk> messages(count);
+        std::vector<const uint8_t*> in(count);
+        std::vector<size_t> sizes(count);
+        for (size_t j = 0; j < count; ++j)
+        {
+            messages[j].resize(j * 37, static_cast<uint8_t>(j));
+            in[j] = messages[j].data();
+            sizes[j] = messages[j].size();
+        }
+
+        std::vector<hash_digest> out(count);
+        double_sha256_multiple(out.empty() ? nullptr : out.front().data(),
+            in.data(), sizes.data(), count);
+
+        for (size_t j = 0; j < count; ++j)
+            BOOST_REQUIRE_EQUAL(out[j], bitcoin_hash(messages[j]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__hash160_multiple__varied_sizes__vs_bitcoin_short_hash__same)
+{
+    data_chunk data(300);
+    for (size_t j = 0; j < data.size(); ++j)
+        data[j] = static_cast<uint8_t>(j * 13 + 5);
+
+    constexpr size_t count = 11;
+    const uint8_t* in[count]{};
+    size_t sizes[count]{};
+    for (size_t j = 0; j < count; ++j)
+    {
+        in[j] = data.data() + j;
+        sizes[j] = is_odd(j) ? 33 : j * 19;
+    }
+
+    uint8_t out[count * short_hash_size]{};
+    hash160_multiple(out, in, sizes, count);
+
+    for (size_t j = 0; j < count; ++j)
+    {
+        const auto expected = bitcoin_short_hash({ in[j], in[j] + sizes[j] });
+        BOOST_REQUIRE_EQUAL(memcmp(&out[j * short_hash_size], expected.data(), short_hash_size), 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__siphash_multiple__varied_sizes__vs_siphash__same)
+{
+    data_chunk data(100);
+    for (size_t j = 0; j < data.size(); ++j)
+        data[j] = static_cast<uint8_t>(j * 7 + 3);
+
+    // Sizes span empty, word boundaries and unbalanced lanes.
+    constexpr size_t count = 13;
+    const size_t sizes[count]{ 0, 1, 7, 8, 9, 15, 16, 17, 33, 64, 3, 70, 22 };
+    const uint64_t key[2]{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+    const uint8_t* in[count]{};
+    for (size_t j = 0; j < count; ++j)
+        in[j] = data.data() + j;
+
+    uint64_t out[count]{};
+    siphash_multiple(out, key, in, sizes, count);
+
+    const siphash_key tuple{ key[0], key[1] };
+    for (size_t j = 0; j < count; ++j)
+        BOOST_REQUIRE_EQUAL(out[j], siphash(tuple, { in[j], in[j] + sizes[j] }));
+}
+
+BOOST_AUTO_TEST_CASE(intrinsics__sha256_nonce_scan__first_match__vs_bitcoin_hash__same)
+{
+    uint8_t header[80]{};
+    for (size_t j = 0; j < sizeof(header); ++j)
+        header[j] = static_cast<uint8_t>(j * 11 + 7);
+
+    // Target of 2^248 - 1 (most significant byte zero), about 1 in 256.
+    uint8_t target[32]{};
+    std::fill_n(target, 31, 0xff);
+
+    uint32_t expected{};
+    for (uint32_t nonce = 5; nonce < 5000; ++nonce)
+    {
+        const auto bytes = to_little_endian(nonce);
+        std::copy(bytes.begin(), bytes.end(), &header[76]);
+        if (is_zero(bitcoin_hash({ header, header + 80 }).back()))
+        {
+            expected = nonce;
+            break;
+        }
+    }
+
+    BOOST_REQUIRE(!is_zero(expected));
+
+    uint32_t nonce{};
+    BOOST_REQUIRE(sha256_nonce_scan(nonce, header, 5, 5000, target));
+    BOOST_REQUIRE_EQUAL(nonce, expected);
+    BOOST_REQUIRE(!sha256_nonce_scan(nonce, header, 5, expected - 5, target));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
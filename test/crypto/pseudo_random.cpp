@@ -79,4 +79,13 @@ BOOST_AUTO_TEST_CASE(pseudo_random__duration__superminute_ratio_255__expected)
     BOOST_REQUIRE(result >= minimum);
 }
 
+BOOST_AUTO_TEST_CASE(pseudo_random__entropy__two_fills__distinct)
+{
+    hash_digest first{};
+    hash_digest second{};
+    BOOST_REQUIRE(pseudo_random::entropy(first));
+    BOOST_REQUIRE(pseudo_random::entropy(second));
+    BOOST_REQUIRE(first != second);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
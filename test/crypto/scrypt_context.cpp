@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(scrypt_context_tests)
+
+// RFC 7914 test vectors.
+static const auto empty_expected = base16_chunk(
+    "77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442"
+    "fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906");
+static const auto password_expected = base16_chunk(
+    "fdbabe1c9d3472007856e7190d01e9fe7c6ad7cbc8237830e77376634b373162"
+    "2eaf30d92e22a3886ff109279d9830dac727afb94a83ee6d8360cbdfa2cc0640");
+
+BOOST_AUTO_TEST_CASE(scrypt_context__hash__rfc7914_vectors__expected)
+{
+    scrypt_context context{};
+    BOOST_REQUIRE_EQUAL(context.hash({}, {}, 16, 1, 1, 64), empty_expected);
+    BOOST_REQUIRE_EQUAL(context.hash("password", "NaCl", 1024, 8, 16, 64), password_expected);
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_context__hash__reused_thread_counts__expected)
+{
+    for (const auto threads: { 1_size, 3_size, 16_size, 32_size })
+    {
+        scrypt_context context{ threads };
+        BOOST_REQUIRE_EQUAL(context.hash("password", "NaCl", 1024, 8, 16, 64), password_expected);
+        BOOST_REQUIRE_EQUAL(context.hash({}, {}, 16, 1, 1, 64), empty_expected);
+        BOOST_REQUIRE_EQUAL(context.hash("password", "NaCl", 1024, 8, 16, 64), password_expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_context__hash__array__scrypt_chunk)
+{
+    scrypt_context context{};
+    const auto expected = scrypt_chunk("data", "salt", 256, 2, 3, hash_size);
+    BOOST_REQUIRE_EQUAL(to_chunk(context.hash<hash_size>("data", "salt", 256, 2, 3)), expected);
+}
+
+// Expectations computed by the scalar (non-sse2) smix.
+BOOST_AUTO_TEST_CASE(scrypt_context__hash__single_work__scalar_expected)
+{
+    const auto expected1 = base16_chunk("7200166b6135021425e22f1407c3ab4db4a0134cb2ab030e1cfc52b31f7210d8");
+    const auto expected3 = base16_chunk("820c83a32f11c659b03f56dbfd9e4eb544aa285dbb06da384280b549dc41041f");
+    BOOST_REQUIRE_EQUAL(scrypt_chunk("password", "NaCl", 1, 1, 1, 32), expected1);
+    BOOST_REQUIRE_EQUAL(scrypt_chunk("password", "NaCl", 1, 2, 3, 32), expected3);
+
+    scrypt_context context{ 3 };
+    BOOST_REQUIRE_EQUAL(context.hash("password", "NaCl", 1, 1, 1, 32), expected1);
+    BOOST_REQUIRE_EQUAL(context.hash("password", "NaCl", 1, 2, 3, 32), expected3);
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_context__hash__invalid_work__zeroized)
+{
+    scrypt_context context{};
+    BOOST_REQUIRE_EQUAL(context.hash("data", "salt", 3, 1, 1, 32), data_chunk(32, 0x00));
+}
+
+BOOST_AUTO_TEST_CASE(scrypt_context__clear__then_hash__expected)
+{
+    scrypt_context context{ 2 };
+    BOOST_REQUIRE_EQUAL(context.hash({}, {}, 16, 1, 1, 64), empty_expected);
+    context.clear();
+    BOOST_REQUIRE_EQUAL(context.hash({}, {}, 16, 1, 1, 64), empty_expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
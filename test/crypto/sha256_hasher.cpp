@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(sha256_hasher_tests)
+
+BOOST_AUTO_TEST_CASE(sha256_hasher__finalize__empty__sha256_hash)
+{
+    const sha256_hasher hasher{};
+    BOOST_REQUIRE_EQUAL(hasher.finalize(), sha256_hash(data_chunk{}));
+    BOOST_REQUIRE_EQUAL(hasher.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hasher__update__pieces__sha256_hash)
+{
+    data_chunk data(300);
+    for (size_t index = 0; index < data.size(); ++index)
+        data[index] = static_cast<uint8_t>(index);
+
+    // Split at each offset, across block boundaries.
+    for (size_t split = 0; split <= data.size(); split += 7)
+    {
+        sha256_hasher hasher{};
+        hasher.update({ data.data(), data.data() + split });
+        hasher.update({ data.data() + split, data.data() + data.size() });
+        BOOST_REQUIRE_EQUAL(hasher.finalize(), sha256_hash(data));
+        BOOST_REQUIRE_EQUAL(hasher.finalize_double(), bitcoin_hash(data));
+        BOOST_REQUIRE_EQUAL(hasher.size(), data.size());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hasher__finalize__twice__unchanged)
+{
+    sha256_hasher hasher{};
+    hasher.update("abc");
+    BOOST_REQUIRE_EQUAL(hasher.finalize(), sha256_hash("abc"));
+    BOOST_REQUIRE_EQUAL(hasher.finalize(), sha256_hash("abc"));
+    hasher.update("def");
+    BOOST_REQUIRE_EQUAL(hasher.finalize(), sha256_hash("abcdef"));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hasher__copy__checkpoint__independent)
+{
+    const data_chunk prefix(100, 0x42);
+    sha256_hasher checkpoint{};
+    checkpoint.update(prefix);
+
+    auto first = checkpoint;
+    auto second = checkpoint;
+    first.update("first");
+    second.update("second");
+    BOOST_REQUIRE_EQUAL(first.finalize(), sha256_hash(prefix, "first"));
+    BOOST_REQUIRE_EQUAL(second.finalize(), sha256_hash(prefix, "second"));
+    BOOST_REQUIRE_EQUAL(checkpoint.finalize(), sha256_hash(prefix));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hasher__export_midstate__unaligned__false)
+{
+    sha256_hasher hasher{};
+    hasher.update(data_chunk(65, 0x00));
+    sha256_hasher::midstate state{};
+    BOOST_REQUIRE(!hasher.export_midstate(state));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hasher__export_midstate__import__resumed)
+{
+    const data_chunk prefix(128, 0x24);
+    sha256_hasher hasher{};
+    hasher.update(prefix);
+
+    sha256_hasher::midstate state{};
+    BOOST_REQUIRE(hasher.export_midstate(state));
+    BOOST_REQUIRE_EQUAL(state.blocks, 2u);
+
+    sha256_hasher resumed{ state };
+    BOOST_REQUIRE_EQUAL(resumed.size(), prefix.size());
+    resumed.update("suffix");
+    BOOST_REQUIRE_EQUAL(resumed.finalize(), sha256_hash(prefix, "suffix"));
+}
+
+BOOST_AUTO_TEST_CASE(sha256_hasher__reset__empty__sha256_hash)
+{
+    sha256_hasher hasher{};
+    hasher.update("abc");
+    hasher.reset();
+    BOOST_REQUIRE_EQUAL(hasher.size(), 0u);
+    BOOST_REQUIRE_EQUAL(hasher.finalize(), sha256_hash(data_chunk{}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
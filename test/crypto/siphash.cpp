@@ -72,4 +72,48 @@ BOOST_AUTO_TEST_CASE(siphash__key__vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(siphash__batch__empty__empty)
+{
+    BOOST_REQUIRE(siphash_batch({ 1, 2 }, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__vectors__expected)
+{
+    half_hash hash;
+    BOOST_REQUIRE(decode_base16(hash, hash_test_key));
+
+    data_stack messages{};
+    std::vector<uint64_t> expected{};
+    for (const auto& result: siphash_hash_tests)
+    {
+        data_chunk data;
+        BOOST_REQUIRE(decode_base16(data, result.message));
+        messages.push_back(data);
+
+        data_chunk encoded_expected;
+        BOOST_REQUIRE(decode_base16(encoded_expected, result.result));
+        expected.push_back(from_little_endian<uint64_t>(encoded_expected));
+    }
+
+    const auto hashes = siphash_batch(to_siphash_key(hash), messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), expected.size());
+    for (size_t index = 0; index < expected.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], expected[index]);
+}
+
+BOOST_AUTO_TEST_CASE(siphash__batch__many_messages__same_as_siphash)
+{
+    const siphash_key key{ 0x0123456789abcdef, 0xfedcba9876543210 };
+
+    // Spans multiple batch chunks with a partial final lane set.
+    data_stack messages(10001);
+    for (size_t index = 0; index < messages.size(); ++index)
+        messages[index].resize(index % 41, static_cast<uint8_t>(index));
+
+    const auto hashes = siphash_batch(key, messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], siphash(key, messages[index]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(object_pool_tests)
+
+BOOST_AUTO_TEST_CASE(object_pool__retention__default__zero)
+{
+    BOOST_REQUIRE_EQUAL(object_pool::retention(), 0u);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__deallocate__zero_retention__not_retained)
+{
+    object_pool::set_retention(0);
+    object_pool::deallocate(object_pool::allocate(42), 42);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__deallocate__allocated_without_retention__recycled)
+{
+    constexpr auto size = add1(object_pool::granularity);
+    constexpr auto full = 2u * object_pool::granularity;
+    const auto block = object_pool::allocate(size);
+    object_pool::set_retention(1);
+    object_pool::deallocate(block, size);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 1u);
+
+    // Blocks are allocated to the full size class, so reuse is safe.
+    BOOST_REQUIRE_EQUAL(object_pool::allocate(full), block);
+    object_pool::deallocate(block, full);
+    object_pool::set_retention(0);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__retention__other_thread__independent)
+{
+    object_pool::set_retention(1);
+    size_t retention{ 42 };
+    std::thread thread([&]() NOEXCEPT
+    {
+        retention = object_pool::retention();
+        object_pool::deallocate(object_pool::allocate(42), 42);
+    });
+
+    thread.join();
+    BOOST_REQUIRE_EQUAL(retention, 0u);
+    BOOST_REQUIRE_EQUAL(object_pool::retention(), 1u);
+    object_pool::set_retention(0);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__allocate__retained_block__recycled)
+{
+    object_pool::set_retention(2);
+    const auto block = object_pool::allocate(42);
+    object_pool::deallocate(block, 42);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 1u);
+
+    // Same size class is recycled.
+    BOOST_REQUIRE_EQUAL(object_pool::allocate(33), block);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 0u);
+    object_pool::deallocate(block, 33);
+    object_pool::set_retention(0);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__deallocate__exceeds_retention__bounded)
+{
+    object_pool::set_retention(1);
+    const auto block1 = object_pool::allocate(16);
+    const auto block2 = object_pool::allocate(16);
+    object_pool::deallocate(block1, 16);
+    object_pool::deallocate(block2, 16);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 1u);
+    object_pool::trim();
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 0u);
+    object_pool::set_retention(0);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__deallocate__oversized__not_retained)
+{
+    object_pool::set_retention(1);
+    const auto size = add1(object_pool::maximum_size);
+    object_pool::deallocate(object_pool::allocate(size), size);
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 0u);
+    object_pool::set_retention(0);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__to_pooled__value__expected)
+{
+    object_pool::set_retention(1);
+    {
+        const auto instance = to_pooled<chain::point>(null_hash, 42u);
+        BOOST_REQUIRE_EQUAL(instance->index(), 42u);
+    }
+
+    BOOST_REQUIRE_EQUAL(object_pool::retained(), 1u);
+    object_pool::set_retention(0);
+}
+
+BOOST_AUTO_TEST_CASE(object_pool__transaction__from_data_pooled__round_trips)
+{
+    object_pool::set_retention(8);
+    const chain::transaction expected
+    {
+        1,
+        { { { null_hash, 42 }, {}, 7 } },
+        { chain::output{ 24, chain::script{} } },
+        0
+    };
+
+    const auto data = expected.to_data(true);
+    const chain::transaction instance(data, true);
+    BOOST_REQUIRE(instance == expected);
+    object_pool::set_retention(0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(open_set_tests)
+
+using namespace system::chain;
+
+constexpr auto hash1 = base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f");
+constexpr auto hash2 = base16_hash("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b");
+
+BOOST_AUTO_TEST_CASE(open_set__construct__zero__empty_nonzero_capacity)
+{
+    const open_set<hash_digest> instance(0);
+    BOOST_REQUIRE(instance.empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(open_set__construct__count__power_of_two_capacity_exceeds_twice_count)
+{
+    const open_set<hash_digest> instance(5);
+    BOOST_REQUIRE_EQUAL(instance.capacity(), 16u);
+    BOOST_REQUIRE(instance.capacity() > 2u * 5u);
+}
+
+BOOST_AUTO_TEST_CASE(open_set__insert__distinct__true)
+{
+    open_set<hash_digest> instance(2);
+    BOOST_REQUIRE(instance.insert(hash1));
+    BOOST_REQUIRE(instance.insert(hash2));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(!instance.empty());
+}
+
+BOOST_AUTO_TEST_CASE(open_set__insert__duplicate__false)
+{
+    open_set<hash_digest> instance(2);
+    BOOST_REQUIRE(instance.insert(hash1));
+    BOOST_REQUIRE(!instance.insert(hash1));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(open_set__contains__inserted__true)
+{
+    open_set<hash_digest> instance(2);
+    BOOST_REQUIRE(!instance.contains(hash1));
+    BOOST_REQUIRE(instance.insert(hash1));
+    BOOST_REQUIRE(instance.contains(hash1));
+    BOOST_REQUIRE(!instance.contains(hash2));
+}
+
+BOOST_AUTO_TEST_CASE(open_set__insert__full__false)
+{
+    open_set<uint32_t> instance(0);
+    BOOST_REQUIRE(instance.insert(1));
+    BOOST_REQUIRE(instance.insert(2));
+    BOOST_REQUIRE(!instance.insert(3));
+    BOOST_REQUIRE(!instance.contains(3));
+    BOOST_REQUIRE_EQUAL(instance.size(), instance.capacity());
+}
+
+BOOST_AUTO_TEST_CASE(open_set__insert__colliding_hashes__distinct)
+{
+    struct collide
+    {
+        size_t operator()(const point&) const NOEXCEPT
+        {
+            return 42;
+        }
+    };
+
+    open_set<point, collide> instance(3);
+    BOOST_REQUIRE(instance.insert({ hash1, 0 }));
+    BOOST_REQUIRE(instance.insert({ hash1, 1 }));
+    BOOST_REQUIRE(instance.insert({ hash2, 0 }));
+    BOOST_REQUIRE(!instance.insert({ hash1, 1 }));
+    BOOST_REQUIRE(instance.contains({ hash2, 0 }));
+    BOOST_REQUIRE(!instance.contains({ hash2, 1 }));
+    BOOST_REQUIRE_EQUAL(instance.size(), 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
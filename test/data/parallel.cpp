@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include <atomic>
+#include <thread>
+
+BOOST_AUTO_TEST_SUITE(parallel_tests)
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__zero__not_invoked)
+{
+    std::atomic_size_t calls{};
+    parallel_for(0, [&](size_t) NOEXCEPT { ++calls; });
+    BOOST_REQUIRE_EQUAL(calls.load(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__one__invoked_once)
+{
+    std::atomic_size_t calls{};
+    parallel_for(1, [&](size_t index) NOEXCEPT { calls += add1(index); });
+    BOOST_REQUIRE_EQUAL(calls.load(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__many__each_index_invoked_once)
+{
+    constexpr size_t count = 1001;
+    std::vector<size_t> visits(count);
+    parallel_for(count, [&](size_t index) NOEXCEPT { ++visits[index]; });
+    BOOST_REQUIRE(std::all_of(visits.begin(), visits.end(), [](size_t visit)
+    {
+        return visit == 1u;
+    }));
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__nested__each_index_invoked_once)
+{
+    constexpr size_t count = 101;
+    std::atomic_size_t calls{};
+    parallel_for(count, [&](size_t) NOEXCEPT
+    {
+        parallel_for(count, [&](size_t) NOEXCEPT { ++calls; });
+    });
+
+    BOOST_REQUIRE_EQUAL(calls.load(), count * count);
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_for__concurrent_callers__each_index_invoked_once)
+{
+    constexpr size_t count = 101;
+    constexpr size_t callers = 4;
+    std::atomic_size_t calls{};
+    std::vector<std::thread> threads{};
+    for (size_t caller = 0; caller < callers; ++caller)
+        threads.emplace_back([&]()
+        {
+            parallel_for(count, [&](size_t) NOEXCEPT { ++calls; });
+        });
+
+    for (auto& thread: threads)
+        thread.join();
+
+    BOOST_REQUIRE_EQUAL(calls.load(), count * callers);
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_threads__always__nonzero)
+{
+    BOOST_REQUIRE(!is_zero(parallel_threads()));
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_all_of__zero__true)
+{
+    BOOST_REQUIRE(parallel_all_of(0, [](size_t) NOEXCEPT { return false; }));
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_all_of__all_true__true)
+{
+    BOOST_REQUIRE(parallel_all_of(100, [](size_t) NOEXCEPT { return true; }));
+}
+
+BOOST_AUTO_TEST_CASE(parallel__parallel_all_of__one_false__false)
+{
+    BOOST_REQUIRE(!parallel_all_of(100, [](size_t index) NOEXCEPT
+    {
+        return index != 42u;
+    }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -108,4 +108,73 @@ BOOST_AUTO_TEST_CASE(base58__decode_base58__array__expected)
     BOOST_REQUIRE_EQUAL(converted, expected);
 }
 
+BOOST_AUTO_TEST_CASE(base58__append_base58__leading_zeros__appended)
+{
+    std::string out{ "prefix" };
+    append_base58(out, base16_chunk("00005cc87f4a3fdfe3a2346b6953267ca867282630d3f9b78e64"));
+    BOOST_REQUIRE_EQUAL(out, "prefix119TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT");
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_decode__limb_boundaries__round_trip)
+{
+    // Sizes span partial and whole limbs of both four bytes and five digits.
+    for (size_t size = 0; size < 70; ++size)
+    {
+        data_chunk data(size, 0xff);
+        if (!data.empty())
+            data.front() = 0x00;
+
+        const auto encoded = encode_base58(data);
+        BOOST_REQUIRE(is_base58(encoded));
+
+        data_chunk decoded;
+        BOOST_REQUIRE(decode_base58(decoded, encoded));
+        BOOST_REQUIRE_EQUAL(decoded, data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__array__expected)
+{
+    const auto data = base16_array("005cc87f4a3fdfe3a2346b6953267ca867282630d3f9b78e64");
+    BOOST_REQUIRE_EQUAL(encode_base58(data), "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT");
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_base58__zero_array__ones)
+{
+    const data_array<5> data{};
+    BOOST_REQUIRE_EQUAL(encode_base58(data), "11111");
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__array_wrong_size__false)
+{
+    data_array<24> short_out;
+    data_array<26> long_out;
+    BOOST_REQUIRE(!decode_base58(short_out, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+    BOOST_REQUIRE(!decode_base58(long_out, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFViT"));
+}
+
+BOOST_AUTO_TEST_CASE(base58__decode_base58__array_invalid_character__false)
+{
+    data_array<25> out;
+    BOOST_REQUIRE(!decode_base58(out, "19TbMSWwHvnxAKy12iNm3KdbGfzfaMFVi0"));
+}
+
+BOOST_AUTO_TEST_CASE(base58__encode_decode__array_sizes__round_trip)
+{
+    // Sizes of addresses, wif keys and hd keys, with a leading zero byte.
+    const auto test = [](auto data) NOEXCEPT
+    {
+        data.fill(0xa5);
+        data.front() = 0x00;
+        auto copy = data;
+        copy.fill(0xff);
+        return decode_base58(copy, encode_base58(data)) && copy == data;
+    };
+
+    BOOST_REQUIRE(test(data_array<25>{}));
+    BOOST_REQUIRE(test(data_array<37>{}));
+    BOOST_REQUIRE(test(data_array<38>{}));
+    BOOST_REQUIRE(test(data_array<82>{}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -287,4 +287,77 @@ BOOST_AUTO_TEST_CASE(payment_address__hash__compressed_point__expected)
     BOOST_REQUIRE_EQUAL(encode_base16(address.hash()), COMPRESSED_HASH);
 }
 
+// bulk
+
+BOOST_AUTO_TEST_CASE(payment_address__encode__hashes__expected)
+{
+    short_hash compressed;
+    short_hash uncompressed;
+    BOOST_REQUIRE(decode_base16(compressed, COMPRESSED_HASH));
+    BOOST_REQUIRE(decode_base16(uncompressed, UNCOMPRESSED_HASH));
+
+    std::string out;
+    payment_address::encode(out, { compressed, uncompressed });
+    BOOST_REQUIRE_EQUAL(out, ADDRESS_COMPRESSED "\n" ADDRESS_UNCOMPRESSED);
+
+    out.clear();
+    payment_address::encode(out, { compressed, uncompressed }, 0x6f, ' ');
+    BOOST_REQUIRE_EQUAL(out, ADDRESS_COMPRESSED_TESTNET " " ADDRESS_UNCOMPRESSED_TESTNET);
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__encode__empty__empty)
+{
+    std::string out;
+    payment_address::encode(out, {});
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__decode__addresses__expected)
+{
+    short_hash compressed;
+    short_hash uncompressed;
+    BOOST_REQUIRE(decode_base16(compressed, COMPRESSED_HASH));
+    BOOST_REQUIRE(decode_base16(uncompressed, UNCOMPRESSED_HASH));
+
+    short_hash_list out;
+    BOOST_REQUIRE(payment_address::decode(out, ADDRESS_COMPRESSED "\n" ADDRESS_UNCOMPRESSED));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out[0], compressed);
+    BOOST_REQUIRE_EQUAL(out[1], uncompressed);
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__decode__round_trip__expected)
+{
+    short_hash_list hashes(1000);
+    for (size_t index = 0; index < hashes.size(); ++index)
+        hashes[index] = bitcoin_short_hash(to_little_endian(index));
+
+    std::string encoded;
+    payment_address::encode(encoded, hashes, payment_address::testnet_p2sh);
+
+    short_hash_list out;
+    BOOST_REQUIRE(payment_address::decode(out, encoded, payment_address::testnet_p2sh));
+    BOOST_REQUIRE(out == hashes);
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__decode__wrong_prefix__false)
+{
+    short_hash_list out;
+    BOOST_REQUIRE(!payment_address::decode(out, ADDRESS_COMPRESSED "\n" ADDRESS_COMPRESSED_TESTNET));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__decode__invalid_checksum__false)
+{
+    short_hash_list out;
+    BOOST_REQUIRE(!payment_address::decode(out, ADDRESS_COMPRESSED "\n" "1PeChFbhxDD9NLbU21DfD55aQBC4ZTR3tF"));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(payment_address__decode__trailing_delimiter__false)
+{
+    short_hash_list out;
+    BOOST_REQUIRE(!payment_address::decode(out, ADDRESS_COMPRESSED "\n"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
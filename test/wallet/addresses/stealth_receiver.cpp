@@ -82,4 +82,60 @@ BOOST_AUTO_TEST_CASE(stealth_receiver__exchange_between_sender_and_receiver__alw
     BOOST_REQUIRE_EQUAL(payment_address(receiver_public, version), derived_address);
 }
 
+BOOST_AUTO_TEST_CASE(stealth_receiver__scan__filtered_payment__expected)
+{
+    static const auto version = payment_address::testnet_p2kh;
+    const hd_private main_key(MAIN_KEY, hd_private::testnet);
+    const auto& scan_private = main_key.derive_private(0 + hd_first_hardened_key).secret();
+    const auto& spend_private = main_key.derive_private(1 + hd_first_hardened_key).secret();
+
+    const binary filter{ "10101" };
+    const stealth_receiver receiver(scan_private, spend_private, filter, version);
+    BOOST_REQUIRE(receiver);
+
+    ec_secret ephemeral_private;
+    BOOST_REQUIRE(decode_base16(ephemeral_private, EPHEMERAL_PRIVATE));
+    const stealth_sender sender(ephemeral_private, receiver.stealth_address(), data_chunk{}, filter, version);
+    BOOST_REQUIRE(sender);
+
+    // The first tx pays the same address without a stealth output, so only the
+    // second tx (stealth output followed by payment) is a stealth payment.
+    const chain::output unrelated{ 42, payment_address(DERIVED_ADDRESS).output_script() };
+    const chain::transaction first{ 1, chain::inputs{}, chain::outputs{ unrelated }, 0 };
+    const chain::transaction second
+    {
+        1,
+        chain::inputs{},
+        chain::outputs
+        {
+            { 0, sender.stealth_script() },
+            { 42, sender.payment_address().output_script() }
+        },
+        0
+    };
+
+    const chain::block block{ chain::header{}, chain::transactions{ first, second } };
+
+    stealth_receiver::payments payments;
+    BOOST_REQUIRE(receiver.scan(payments, block));
+    BOOST_REQUIRE_EQUAL(payments.size(), 1u);
+    BOOST_REQUIRE_EQUAL(payments.front().transaction, 1u);
+    BOOST_REQUIRE_EQUAL(payments.front().stealth, 0u);
+    BOOST_REQUIRE_EQUAL(payments.front().output, 1u);
+
+    ec_compressed ephemeral_public;
+    BOOST_REQUIRE(extract_ephemeral_key(ephemeral_public, sender.stealth_script()));
+    BOOST_REQUIRE_EQUAL(payments.front().ephemeral_public, ephemeral_public);
+
+    ec_secret receiver_private;
+    BOOST_REQUIRE(receiver.derive_private(receiver_private, payments.front().ephemeral_public));
+    BOOST_REQUIRE_EQUAL(encode_base16(receiver_private), RECEIVER_PRIVATE);
+
+    // The mined prefix does not match the inverse filter.
+    const stealth_receiver other(scan_private, spend_private, binary{ "01010" }, version);
+    BOOST_REQUIRE(other);
+    BOOST_REQUIRE(other.scan(payments, block));
+    BOOST_REQUIRE(payments.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
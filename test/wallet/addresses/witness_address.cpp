@@ -1071,4 +1071,86 @@ BOOST_AUTO_TEST_CASE(witness_address__bip173__invalid_address10__payload_too_sho
     BOOST_REQUIRE(witness_address::parse_address(out1, out2, out3, "bc1gmk9yu") == result::payload_too_short);
 }
 
+// bulk
+
+BOOST_AUTO_TEST_CASE(witness_address__encode__hashes__expected)
+{
+    const auto hash = base16_array("751e76e8199196d454941c45d1b3a323f1433bd6");
+
+    std::string out;
+    BOOST_REQUIRE(witness_address::encode(out, { hash, null_short_hash }));
+    BOOST_REQUIRE_EQUAL(out, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4\n" + witness_address(null_short_hash).encoded());
+
+    out.clear();
+    BOOST_REQUIRE(witness_address::encode(out, { hash }, witness_address::testnet));
+    BOOST_REQUIRE_EQUAL(out, "tb1qw508d6qejxtdg4y5r3zarvary0c5xw7kxpjzsx");
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__encode__invalid_prefix__false)
+{
+    std::string out;
+    BOOST_REQUIRE(!witness_address::encode(out, { null_short_hash }, "BC"));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__addresses__expected)
+{
+    const auto hash = base16_array("751e76e8199196d454941c45d1b3a323f1433bd6");
+
+    short_hash_list out;
+    BOOST_REQUIRE(witness_address::decode(out, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4 BC1QW508D6QEJXTDG4Y5R3ZARVARY0C5XW7KV8F3T4", witness_address::mainnet, ' '));
+    BOOST_REQUIRE_EQUAL(out.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out[0], hash);
+    BOOST_REQUIRE_EQUAL(out[1], hash);
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__round_trip__expected)
+{
+    short_hash_list hashes(1000);
+    for (size_t index = 0; index < hashes.size(); ++index)
+        hashes[index] = bitcoin_short_hash(to_little_endian(index));
+
+    std::string encoded;
+    BOOST_REQUIRE(witness_address::encode(encoded, hashes, "bcrt"));
+
+    short_hash_list out;
+    BOOST_REQUIRE(witness_address::decode(out, encoded, "bcrt"));
+    BOOST_REQUIRE(out == hashes);
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__mixed_case__false)
+{
+    short_hash_list out;
+    BOOST_REQUIRE(!witness_address::decode(out, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3T4"));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__invalid_checksum__false)
+{
+    short_hash_list out;
+    BOOST_REQUIRE(!witness_address::decode(out, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t5"));
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__wrong_prefix__false)
+{
+    short_hash_list out;
+    BOOST_REQUIRE(!witness_address::decode(out, "tb1qw508d6qejxtdg4y5r3zarvary0c5xw7kxpjzsx"));
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__p2sh__false)
+{
+    short_hash_list out;
+    BOOST_REQUIRE(!witness_address::decode(out, "tb1qrp33g0q5c5txsp9arysrx4k6zdkfs4nce4xj0gdcccefvpysxf3q0sl5k7", witness_address::testnet));
+}
+
+BOOST_AUTO_TEST_CASE(witness_address__decode__non_ascii_data__false)
+{
+    short_hash_list out;
+    std::string address{ "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4" };
+    address[10] = static_cast<char>(0xe9);
+    BOOST_REQUIRE(!witness_address::decode(out, address));
+    address[10] = static_cast<char>(0xff);
+    BOOST_REQUIRE(!witness_address::decode(out, address));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
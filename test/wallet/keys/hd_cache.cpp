@@ -0,0 +1,158 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(hd_cache_tests)
+
+using namespace bc::system::wallet;
+
+#define LONG_SEED "fffcf9f6f3f0edeae7e4e1dedbd8d5d2cfccc9c6c3c0bdbab7b4b1aeaba8a5a29f9c999693908d8a8784817e7b7875726f6c696663605d5a5754514e4b484542"
+
+static hd_private derive_path(const hd_private& root, const hd_path& path)
+{
+    auto key = root;
+    for (const auto index: path)
+        key = key.derive_private(index);
+
+    return key;
+}
+
+// path
+
+BOOST_AUTO_TEST_CASE(hd_cache__decode_hd_path__valid__expected)
+{
+    hd_path path;
+    BOOST_REQUIRE(decode_hd_path(path, "m/84'/0h/0H/1/2147483647"));
+    BOOST_REQUIRE_EQUAL(path.size(), 5u);
+    BOOST_REQUIRE_EQUAL(path[0], 84u + hd_first_hardened_key);
+    BOOST_REQUIRE_EQUAL(path[1], hd_first_hardened_key);
+    BOOST_REQUIRE_EQUAL(path[2], hd_first_hardened_key);
+    BOOST_REQUIRE_EQUAL(path[3], 1u);
+    BOOST_REQUIRE_EQUAL(path[4], 2147483647u);
+    BOOST_REQUIRE_EQUAL(encode_hd_path(path), "m/84'/0'/0'/1/2147483647");
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__decode_hd_path__root__empty)
+{
+    hd_path path{ 42 };
+    BOOST_REQUIRE(decode_hd_path(path, "m"));
+    BOOST_REQUIRE(path.empty());
+    BOOST_REQUIRE_EQUAL(encode_hd_path(path), "m");
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__decode_hd_path__invalid__false)
+{
+    hd_path path;
+    BOOST_REQUIRE(!decode_hd_path(path, ""));
+    BOOST_REQUIRE(!decode_hd_path(path, "0/1"));
+    BOOST_REQUIRE(!decode_hd_path(path, "m/"));
+    BOOST_REQUIRE(!decode_hd_path(path, "m//1"));
+    BOOST_REQUIRE(!decode_hd_path(path, "m/'"));
+    BOOST_REQUIRE(!decode_hd_path(path, "m/1x"));
+    BOOST_REQUIRE(!decode_hd_path(path, "m/-1"));
+    BOOST_REQUIRE(!decode_hd_path(path, "m/2147483648"));
+    BOOST_REQUIRE(!decode_hd_path(path, "m/99999999999"));
+}
+
+// hd_private_cache
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive__private_siblings__expected_and_parents_cached)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+    const hd_private root(seed, hd_private::mainnet);
+
+    hd_private_cache cache(root);
+    BOOST_REQUIRE(cache.root() == root);
+    BOOST_REQUIRE(cache.derive({}) == root);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+
+    hd_path path;
+    BOOST_REQUIRE(decode_hd_path(path, "m/84'/0'/0'/0/0"));
+
+    for (uint32_t index = 0; index < 5; ++index)
+    {
+        path.back() = index;
+        BOOST_REQUIRE(cache.derive(path) == derive_path(root, path));
+    }
+
+    // Only the four parents are cached.
+    BOOST_REQUIRE_EQUAL(cache.size(), 4u);
+
+    // The change branch shares three parents.
+    BOOST_REQUIRE(decode_hd_path(path, "m/84'/0'/0'/1/7"));
+    BOOST_REQUIRE(cache.derive(path) == derive_path(root, path));
+    BOOST_REQUIRE_EQUAL(cache.size(), 5u);
+
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0u);
+    BOOST_REQUIRE(cache.derive(path) == derive_path(root, path));
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive__capacity__bounded_and_expected)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+    const hd_private root(seed, hd_private::mainnet);
+
+    hd_private_cache cache(root, 3);
+    for (uint32_t account = 0; account < 4; ++account)
+    {
+        const hd_path path{ 44 + hd_first_hardened_key, account, 0, 9 };
+        BOOST_REQUIRE(cache.derive(path) == derive_path(root, path));
+        BOOST_REQUIRE(cache.size() <= 3u);
+    }
+
+    // Evicted parents are derived again.
+    const hd_path path{ 44 + hd_first_hardened_key, 0, 0, 3 };
+    BOOST_REQUIRE(cache.derive(path) == derive_path(root, path));
+}
+
+// hd_public_cache
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive__public__expected)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+    const hd_private root(seed, hd_private::mainnet);
+    const auto account = root.derive_private(hd_first_hardened_key);
+
+    hd_public_cache cache(account.to_public());
+    for (uint32_t index = 0; index < 3; ++index)
+    {
+        const hd_path path{ 1, index };
+        BOOST_REQUIRE(cache.derive(path) == derive_path(account, path).to_public());
+    }
+
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(hd_cache__derive__public_hardened__invalid)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+    const hd_private root(seed, hd_private::mainnet);
+
+    hd_public_cache cache(root.to_public());
+    BOOST_REQUIRE(!cache.derive({ hd_first_hardened_key, 0 }));
+    BOOST_REQUIRE(!cache.derive({ 0, hd_first_hardened_key }));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
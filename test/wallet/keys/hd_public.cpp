@@ -44,6 +44,12 @@ BOOST_AUTO_TEST_CASE(hd_public__encoded__round_trip__expected)
     BOOST_REQUIRE_EQUAL(key.encoded(), encoded);
 }
 
+BOOST_AUTO_TEST_CASE(hd_public__construct__invalid_checksum__invalid)
+{
+    static const auto encoded = "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet9";
+    BOOST_REQUIRE(!hd_public(encoded));
+}
+
 BOOST_AUTO_TEST_CASE(hd_public__derive_public__short_seed__expected)
 {
     data_chunk seed;
@@ -93,4 +99,48 @@ BOOST_AUTO_TEST_CASE(hd_public__derive_public__long_seed__expected)
     BOOST_REQUIRE_EQUAL(m0xH1yH2_pub.encoded(), "xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt");
 }
 
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__long_seed__derive_public)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    const auto children = m_pub.derive_public_range(5, 20);
+    BOOST_REQUIRE_EQUAL(children.size(), 20u);
+
+    for (uint32_t index = 0; index < 20; ++index)
+        BOOST_REQUIRE_EQUAL(children[index], m_pub.derive_public(5 + index).point());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_short_hash_range__long_seed__bitcoin_short_hash)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    const auto hashes = m_pub.derive_short_hash_range(0, 9);
+    BOOST_REQUIRE_EQUAL(hashes.size(), 9u);
+
+    for (uint32_t index = 0; index < 9; ++index)
+        BOOST_REQUIRE_EQUAL(hashes[index], bitcoin_short_hash(m_pub.derive_public(index).point()));
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__hardened__empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_public m_pub = hd_private(seed, hd_private::mainnet);
+    BOOST_REQUIRE(m_pub.derive_public_range(hd_first_hardened_key - 1, 2).empty());
+    BOOST_REQUIRE(m_pub.derive_public_range(hd_first_hardened_key, 1).empty());
+    BOOST_REQUIRE_EQUAL(m_pub.derive_public_range(hd_first_hardened_key - 1, 1).size(), 1u);
+    BOOST_REQUIRE(m_pub.derive_public_range(0, 0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__invalid__empty)
+{
+    const hd_public key;
+    BOOST_REQUIRE(key.derive_public_range(0, 3).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../../test.hpp"
+#include <algorithm>
 #include <utility>
 #include <sstream>
 #include "mnemonic.hpp"
@@ -621,6 +622,96 @@ BOOST_AUTO_TEST_CASE(mnemonic__construct_sentence__vectors_ja__expected)
 #endif
 }
 
+// validate/to_seeds
+
+static mnemonic::dictionary::search to_indexes(const mnemonic_vector& vector)
+{
+    static const mnemonic::dictionary dictionary{ language::en, words::mnemonic::en };
+    mnemonic::dictionary::search out;
+    for (const auto& word: vector.words())
+        out.push_back(system::possible_sign_cast<size_t>(dictionary.index(word)));
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__validate__vectors_en__all_valid)
+{
+    for (const auto word_count: { 12u, 18u, 24u })
+    {
+        mnemonic::dictionary::search candidates;
+        for (const auto& vector: vectors_en)
+        {
+            const auto indexes = to_indexes(vector);
+            if (indexes.size() == word_count)
+                candidates.insert(candidates.end(), indexes.begin(), indexes.end());
+        }
+
+        std::vector<bool> valid;
+        BOOST_REQUIRE(mnemonic::validate(valid, candidates, word_count));
+        BOOST_REQUIRE_EQUAL(valid.size(), candidates.size() / word_count);
+        BOOST_REQUIRE(std::all_of(valid.begin(), valid.end(), [](bool value) { return value; }));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__validate__bad_checksum__invalid)
+{
+    // "abandon" x 11 + "about" is valid, "abandon" x 12 is not.
+    mnemonic::dictionary::search candidates(2u * 12u, 0u);
+    candidates[11] = 3;
+
+    std::vector<bool> valid;
+    BOOST_REQUIRE(mnemonic::validate(valid, candidates, 12));
+    BOOST_REQUIRE_EQUAL(valid.size(), 2u);
+    BOOST_REQUIRE(valid[0]);
+    BOOST_REQUIRE(!valid[1]);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__validate__invalid_parameters__false)
+{
+    std::vector<bool> valid;
+    BOOST_REQUIRE(!mnemonic::validate(valid, mnemonic::dictionary::search(13u, 0u), 12));
+    BOOST_REQUIRE(!mnemonic::validate(valid, mnemonic::dictionary::search(11u, 0u), 11));
+
+    mnemonic::dictionary::search candidates(12u, 0u);
+    candidates[5] = mnemonic::dictionary::size();
+    BOOST_REQUIRE(!mnemonic::validate(valid, candidates, 12));
+    BOOST_REQUIRE(valid.empty());
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__to_seeds__vectors_en__expected)
+{
+    for (const auto word_count: { 12u, 18u, 24u })
+    {
+        long_hash_list expected;
+        mnemonic::dictionary::search candidates;
+        for (const auto& vector: vectors_en)
+        {
+            const auto indexes = to_indexes(vector);
+            if (indexes.size() == word_count)
+            {
+                candidates.insert(candidates.end(), indexes.begin(), indexes.end());
+                expected.push_back(vector.seed());
+            }
+        }
+
+        // All english vectors use the passphrase "TREZOR".
+        long_hash_list seeds;
+        BOOST_REQUIRE(mnemonic::to_seeds(seeds, candidates, word_count, language::en, "TREZOR"));
+        BOOST_REQUIRE_EQUAL(seeds, expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic__to_seeds__invalid_parameters__false)
+{
+    long_hash_list seeds;
+    const mnemonic::dictionary::search candidates(12u, 0u);
+    BOOST_REQUIRE(!mnemonic::to_seeds(seeds, candidates, 12, language::none));
+    BOOST_REQUIRE(!mnemonic::to_seeds(seeds, candidates, 11, language::en));
+    BOOST_REQUIRE(seeds.empty());
+    BOOST_REQUIRE(mnemonic::to_seeds(seeds, {}, 12, language::en));
+    BOOST_REQUIRE(seeds.empty());
+}
+
 #endif // VERIFIED_VECTORS
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -68,6 +68,14 @@ BOOST_AUTO_TEST_CASE(catalogs_electrum_v1__all__distinct__true)
     BOOST_REQUIRE(distinct(electrum_v1::pt));
 }
 
+// hashed
+
+BOOST_AUTO_TEST_CASE(catalogs_electrum_v1__all__hashed__true)
+{
+    BOOST_REQUIRE(hashed(electrum_v1::en));
+    BOOST_REQUIRE(hashed(electrum_v1::pt));
+}
+
 // sorted
 
 BOOST_AUTO_TEST_CASE(catalogs_electrum_v1__sorted__unsorted__false)
@@ -122,6 +122,16 @@ static hash_digest identity(const electrum_v1::catalog::words& words)
     return sha256_hash(join(to_string_list(words)));
 }
 
+static bool hashed(const electrum_v1::catalog::words& words)
+{
+    const electrum_v1::catalog dictionary(language::none, words);
+    for (size_t index = 0; index < electrum_v1::catalog::size(); ++index)
+        if (dictionary.index(words.word[index]) != to_signed(index))
+            return false;
+
+    return !is_zero(words.probes) && !dictionary.contains("");
+}
+
 } // catalogs_electrum_v1
 } // test
 
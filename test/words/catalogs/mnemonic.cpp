@@ -84,6 +84,22 @@ BOOST_AUTO_TEST_CASE(catalogs_mnemonic__all__distinct__true)
     BOOST_REQUIRE(distinct(mnemonic::zh_Hant));
 }
 
+// hashed
+
+BOOST_AUTO_TEST_CASE(catalogs_mnemonic__all__hashed__true)
+{
+    BOOST_REQUIRE(hashed(mnemonic::en));
+    BOOST_REQUIRE(hashed(mnemonic::es));
+    BOOST_REQUIRE(hashed(mnemonic::it));
+    BOOST_REQUIRE(hashed(mnemonic::fr));
+    BOOST_REQUIRE(hashed(mnemonic::cs));
+    BOOST_REQUIRE(hashed(mnemonic::pt));
+    BOOST_REQUIRE(hashed(mnemonic::ja));
+    BOOST_REQUIRE(hashed(mnemonic::ko));
+    BOOST_REQUIRE(hashed(mnemonic::zh_Hans));
+    BOOST_REQUIRE(hashed(mnemonic::zh_Hant));
+}
+
 // sorted
 
 BOOST_AUTO_TEST_CASE(catalogs_mnemonic__sorted8__sorted__true)
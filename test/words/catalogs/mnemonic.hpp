@@ -132,6 +132,16 @@ static hash_digest identity(const mnemonic::catalog::words& words)
     return sha256_hash(join(to_string_list(words)));
 }
 
+static bool hashed(const mnemonic::catalog::words& words)
+{
+    const mnemonic::catalog dictionary(language::none, words);
+    for (size_t index = 0; index < mnemonic::catalog::size(); ++index)
+        if (dictionary.index(words.word[index]) != to_signed(index))
+            return false;
+
+    return !is_zero(words.probes) && !dictionary.contains("");
+}
+
 } // catalogs_mnemonic
 } // test
 
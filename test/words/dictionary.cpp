@@ -119,6 +119,22 @@ BOOST_AUTO_TEST_CASE(dictionary__index2__words__expected)
     BOOST_REQUIRE_EQUAL(indexes[5], -1);
 }
 
+BOOST_AUTO_TEST_CASE(dictionary__index1__hashed_words__expected)
+{
+    const auto words = dictionary<test_dictionary_size>::hashed(test_words_es);
+    const dictionary<test_dictionary_size> hashed(language::es, words);
+    BOOST_REQUIRE(is_zero(test_words_es.probes));
+    BOOST_REQUIRE(!is_zero(words.probes));
+
+    for (size_t index = 0; index < test_dictionary_size; ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashed.index(test_words_es.word[index]), to_signed(index));
+    }
+
+    BOOST_REQUIRE_EQUAL(hashed.index("foo"), -1);
+    BOOST_REQUIRE_EQUAL(hashed.index(""), -1);
+}
+
 BOOST_AUTO_TEST_CASE(dictionary__contains1__words__expected)
 {
     BOOST_REQUIRE(instance.contains(test_words_es.word[0]));